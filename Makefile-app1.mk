@@ -28,6 +28,11 @@ semi ?= 0
 etu ?= 0
 bin ?= 0
 uimg ?= 0
+su ?= 0
+fi ?= 0
+bench ?= 0
+qemu ?= 0
+cfg ?=
 
 # These variables are assumed to be set already
 ifndef APP_PROGRAM_NAME1
@@ -65,6 +70,11 @@ SRCS := \
 	$(wildcard $(APP_SRC_PATH1)/trulib/c5soc/*.c) \
 	$(wildcard $(APP_SRC_PATH1)/CMSIS/Core/Source/*.c) \
 	$(wildcard $(APP_SRC_PATH1)/CMSIS/Device/c5soc/source/*.c)
+
+# Benchmark sources
+ifeq ($(bench),1)
+SRCS := $(SRCS) $(wildcard $(APP_SRC_PATH1)/bench/*.c)
+endif
 	
 # Remove exclude files
 SRCS := $(filter-out $(EXCLUDE_SRCS),$(SRCS))
@@ -79,7 +89,11 @@ INCS := \
 	-I$(APP_SRC_PATH1)/CMSIS/Device/c5soc/include
 
 # The linker script to use
+ifeq ($(qemu),1)
+LINKER_SCRIPT := $(APP_SRC_PATH1)/bsp/tru_qemu_vexpressa9.ld
+else
 LINKER_SCRIPT := $(APP_SRC_PATH1)/bsp/tru_c5soc_ddr_core0.ld
+endif
 
 # =========================================
 # Common linker and compiler build settings
@@ -92,6 +106,16 @@ LDFLAGS := -Xlinker --gc-sections --specs=nosys.specs
 CFLAGS_SYMBOL_COMMON := -D_RTE_
 CFLAGS_SYMBOL_DEBUG_SEMI := -DSEMIHOSTING
 CFLAGS_SYMBOL_ETU := -DTRU_EXIT_TO_UBOOT=1
+CFLAGS_SYMBOL_BENCH := -DTRU_BENCH=1
+CFLAGS_SYMBOL_QEMU := -DTRU_QEMU=1
+
+# Compiler flags to output per function stack usage (.su) and call graph (.ci) files
+CFLAGS_STACK_USAGE := -fstack-usage -fcallgraph-info=su
+
+# Compiler flags for the function entry/exit tracer (trulib/arm/tru_trace.c)
+# The startup, CMSIS and the tracer's own sources are excluded, they run before the C runtime or are called by the hooks
+CFLAGS_SYMBOL_TRACE := -DTRU_TRACE=1
+CFLAGS_TRACE := $(CFLAGS_SYMBOL_TRACE) -finstrument-functions -finstrument-functions-exclude-file-list=CMSIS/,tru_cortex_a9.h,tru_trace
 
 # ================================
 # Optimization and Debugging flags
@@ -114,6 +138,26 @@ endif
 ifeq ($(etu),1)
 DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_ETU)
 endif
+# Conditional debug compiler flags
+ifeq ($(su),1)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_STACK_USAGE)
+endif
+# Conditional debug compiler flags
+ifeq ($(fi),1)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_TRACE)
+endif
+# Conditional debug compiler flags
+ifeq ($(bench),1)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_BENCH)
+endif
+# Conditional debug compiler flags
+ifeq ($(qemu),1)
+DBG_CFLAGS := $(DBG_CFLAGS) $(CFLAGS_SYMBOL_QEMU)
+endif
+# Conditional debug compiler flags
+ifneq ($(cfg),)
+DBG_CFLAGS := $(DBG_CFLAGS) $(cfg)
+endif
 # Common debug compiler flags
 DBG_CFLAGS := $(DBG_CFLAGS) $(INCS)
 
@@ -148,6 +192,26 @@ endif
 ifeq ($(etu),1)
 REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_ETU)
 endif
+# Conditional release compiler flags
+ifeq ($(su),1)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_STACK_USAGE)
+endif
+# Conditional release compiler flags
+ifeq ($(fi),1)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_TRACE)
+endif
+# Conditional release compiler flags
+ifeq ($(bench),1)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_BENCH)
+endif
+# Conditional release compiler flags
+ifeq ($(qemu),1)
+REL_CFLAGS := $(REL_CFLAGS) $(CFLAGS_SYMBOL_QEMU)
+endif
+# Conditional release compiler flags
+ifneq ($(cfg),)
+REL_CFLAGS := $(REL_CFLAGS) $(cfg)
+endif
 # Common release compiler flags
 REL_CFLAGS := $(REL_CFLAGS) $(INCS)
 
@@ -179,7 +243,9 @@ DBG_ELF_LOAD_FILE := $(DBG_PATH)/$(APP_PROGRAM_NAME1).load.txt
 DBG_ELF_ENTRY_FILE := $(DBG_PATH)/$(APP_PROGRAM_NAME1).entry.txt
 DBG_BIN := $(DBG_PATH)/$(APP_PROGRAM_NAME1).bin
 DBG_UIMG := $(DBG_PATH)/$(APP_PROGRAM_NAME1).uimg
+DBG_STACK_FILE := $(DBG_PATH)/$(APP_PROGRAM_NAME1).stack.txt
 DBG_OBJS := $(patsubst %.c,$(DBG_PATH)/%.o,$(SRCS))
+DBG_SUS := $(patsubst %.o,%.su,$(DBG_OBJS)) $(patsubst %.o,%.ci,$(DBG_OBJS))
 
 # ======================
 # App settings (Release)
@@ -192,7 +258,9 @@ REL_ELF_LOAD_FILE := $(REL_PATH)/$(APP_PROGRAM_NAME1).load.txt
 REL_ELF_ENTRY_FILE := $(REL_PATH)/$(APP_PROGRAM_NAME1).entry.txt
 REL_BIN := $(REL_PATH)/$(APP_PROGRAM_NAME1).bin
 REL_UIMG := $(REL_PATH)/$(APP_PROGRAM_NAME1).uimg
+REL_STACK_FILE := $(REL_PATH)/$(APP_PROGRAM_NAME1).stack.txt
 REL_OBJS := $(patsubst %.c,$(REL_PATH)/%.o,$(SRCS))
+REL_SUS := $(patsubst %.o,%.su,$(REL_OBJS)) $(patsubst %.o,%.ci,$(REL_OBJS))
 
 # ============================
 # Read elf load addr from file
@@ -233,6 +301,11 @@ OD := $(CROSS_COMPILE)objdump
 RE := $(CROSS_COMPILE)readelf
 SZ := $(CROSS_COMPILE)size
 MK := mkimage
+ifeq ($(OS),Windows_NT)
+PY := python
+else
+PY := python3
+endif
 
 # Represents an empty white space - we need it for extracting the elf entry address from readelf output
 SPACE := $() $()
@@ -266,6 +339,11 @@ help:
 	@echo "  etu=1         Elf exit to U-Boot"
 	@echo "  bin=1         Outputs binary from the elf"
 	@echo "  uimg=1        Outputs U-Boot image from the binary"
+	@echo "  su=1          Outputs static worst-case stack usage report (requires Python 3)"
+	@echo "  fi=1          Function entry/exit tracer (-finstrument-functions)"
+	@echo "  bench=1       Build and run the benchmarks in the bench folder"
+	@echo "  qemu=1        Build for QEMU vexpress-a9 instead of the DE10-Nano"
+	@echo "  cfg=\"...\"     Extra trulib defines, e.g. cfg=\"-DTRU_L1_CACHE=0U -DTRU_MMU=0U\""
 
 # ===========
 # Clean rules
@@ -300,6 +378,7 @@ cleantemp: cleantemp_1
 	@if [ -d "$(APP_OUT_PATH)" ]; then \
 		echo rm -f $(DBG_OBJS) $(DBG_CFLAGS_FILE) $(DBG_ELF_LOAD_FILE) $(DBG_ELF_ENTRY_FILE); rm -f $(DBG_OBJS) $(DBG_CFLAGS_FILE) $(DBG_ELF_LOAD_FILE) $(DBG_ELF_ENTRY_FILE); \
 		echo rm -f $(REL_OBJS) $(REL_CFLAGS_FILE) $(REL_ELF_LOAD_FILE) $(REL_ELF_ENTRY_FILE); rm -f $(REL_OBJS) $(REL_CFLAGS_FILE) $(REL_ELF_LOAD_FILE) $(REL_ELF_ENTRY_FILE); \
+		echo rm -f $(DBG_SUS) $(REL_SUS); rm -f $(DBG_SUS) $(REL_SUS); \
 	fi
 
 # ===========
@@ -326,6 +405,12 @@ debug: $(DBG_UIMG)
 release: $(REL_UIMG)
 endif
 
+ifeq ($(su),1)
+# Add additional target rule
+debug: $(DBG_STACK_FILE)
+release: $(REL_STACK_FILE)
+endif
+
 # =================================================
 # Create prerequisite list for source files (Debug)
 # =================================================
@@ -348,6 +433,47 @@ ifneq (,$(filter $(CFLAGS_SYMBOL_ETU),$(DBG_CFLAGS_FILE_TEXT)))
 DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
 endif
 endif
+# We also want to FORCE build elf if su=1 wasn't used in previous compile, so that the call graph files exist
+ifeq ($(su),1)
+ifeq (,$(filter $(CFLAGS_STACK_USAGE),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if fi=1 differs from the previous compile, so that all functions are instrumented or none
+ifeq ($(fi),1)
+ifeq (,$(filter $(CFLAGS_SYMBOL_TRACE),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_TRACE),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if bench=1 differs from the previous compile, so that main calls the benchmarks or not
+ifeq ($(bench),1)
+ifeq (,$(filter $(CFLAGS_SYMBOL_BENCH),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_BENCH),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if qemu=1 differs from the previous compile, so that everything is built for the same board
+ifeq ($(qemu),1)
+ifeq (,$(filter $(CFLAGS_SYMBOL_QEMU),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_QEMU),$(DBG_CFLAGS_FILE_TEXT)))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if the cfg defines differ from the previous compile, so that everything is built with the same settings
+DBG_CFG_PREV := $(filter-out $(CFLAGS_SYMBOL_COMMON) -DDEBUG $(CFLAGS_SYMBOL_DEBUG_SEMI) $(CFLAGS_SYMBOL_ETU) $(CFLAGS_SYMBOL_TRACE) $(CFLAGS_SYMBOL_BENCH) $(CFLAGS_SYMBOL_QEMU),$(filter -D%,$(DBG_CFLAGS_FILE_TEXT)))
+ifneq ($(sort $(DBG_CFG_PREV)),$(sort $(filter -D%,$(cfg))))
+DBG_SRCS_PRE := $(DBG_SRCS_PRE) FORCE
+endif
 endif
 
 # ==============================
@@ -387,6 +513,47 @@ ifneq (,$(filter $(CFLAGS_SYMBOL_ETU),$(REL_CFLAGS_FILE_TEXT)))
 REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
 endif
 endif
+# We also want to FORCE build elf if su=1 wasn't used in previous compile, so that the call graph files exist
+ifeq ($(su),1)
+ifeq (,$(filter $(CFLAGS_STACK_USAGE),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if fi=1 differs from the previous compile, so that all functions are instrumented or none
+ifeq ($(fi),1)
+ifeq (,$(filter $(CFLAGS_SYMBOL_TRACE),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_TRACE),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if bench=1 differs from the previous compile, so that main calls the benchmarks or not
+ifeq ($(bench),1)
+ifeq (,$(filter $(CFLAGS_SYMBOL_BENCH),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_BENCH),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if qemu=1 differs from the previous compile, so that everything is built for the same board
+ifeq ($(qemu),1)
+ifeq (,$(filter $(CFLAGS_SYMBOL_QEMU),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+else
+ifneq (,$(filter $(CFLAGS_SYMBOL_QEMU),$(REL_CFLAGS_FILE_TEXT)))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
+endif
+# We also want to FORCE build elf if the cfg defines differ from the previous compile, so that everything is built with the same settings
+REL_CFG_PREV := $(filter-out $(CFLAGS_SYMBOL_COMMON) -DDEBUG $(CFLAGS_SYMBOL_DEBUG_SEMI) $(CFLAGS_SYMBOL_ETU) $(CFLAGS_SYMBOL_TRACE) $(CFLAGS_SYMBOL_BENCH) $(CFLAGS_SYMBOL_QEMU),$(filter -D%,$(REL_CFLAGS_FILE_TEXT)))
+ifneq ($(sort $(REL_CFG_PREV)),$(sort $(filter -D%,$(cfg))))
+REL_SRCS_PRE := $(REL_SRCS_PRE) FORCE
+endif
 endif
 
 # ================================
@@ -470,6 +637,18 @@ $(REL_ELF_ENTRY_FILE): $(REL_ELF)
 	$(info ELF-entry-point: $(REL_ELF_ENTRY_TEXT))
 	@echo $(REL_ELF_ENTRY_TEXT) > $(REL_ELF_ENTRY_FILE)
 
+# ========================
+# Stack usage report rules
+# ========================
+
+# Merge the call graph files and write the worst-case stack usage report
+$(DBG_STACK_FILE): $(DBG_ELF)
+	$(PY) $(APP_HOME_PATH)/scripts-py/stack_usage.py $(DBG_PATH) > $@
+
+# Merge the call graph files and write the worst-case stack usage report
+$(REL_STACK_FILE): $(REL_ELF)
+	$(PY) $(APP_HOME_PATH)/scripts-py/stack_usage.py $(REL_PATH) > $@
+
 # ========================
 # ELF to binary file rules
 # ========================
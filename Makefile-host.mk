@@ -0,0 +1,83 @@
+# This is free script released into the public domain.
+# GNU make file v20261019 created by Truong Hy.
+#
+# Builds the hardware independent parts of trulib as a native host program,
+# with the HPS peripheral registers simulated (see trulib/host/tru_host_mmio.h).
+# Useful for running the drivers under AddressSanitizer/UndefinedBehaviorSanitizer,
+# or a debugger/profiler on the development machine.
+#
+# The Arm Cortex-A9 core modules (trulib/arm) use inline assembly and are not built.
+#
+# For usage, type make -f Makefile-host.mk help
+#
+# Requirements:
+#   - Native GCC or Clang, e.g. gcc on Linux
+#   - GNU make
+
+# Optional commandline parameters
+san ?= 1
+
+CC ?= gcc
+APP_SRC_PATH1 ?= source/app1
+HOST_SRC_PATH ?= source/host
+HOST_OUT_PATH ?= _host_build
+HOST_PROGRAM_NAME := trulib_host
+HOST_ELF := $(HOST_OUT_PATH)/$(HOST_PROGRAM_NAME)
+
+HOST_INC := \
+	-I$(APP_SRC_PATH1)/bsp \
+	-I$(APP_SRC_PATH1)/trulib \
+	-I$(APP_SRC_PATH1)/trulib/c5soc \
+	-I$(APP_SRC_PATH1)/trulib/host
+
+HOST_SRC := \
+	$(wildcard $(APP_SRC_PATH1)/trulib/host/*.c) \
+	$(APP_SRC_PATH1)/trulib/c5soc/tru_c5soc_hps_uart_ll.c \
+	$(APP_SRC_PATH1)/trulib/c5soc/tru_c5soc_hps_uart_pt.c \
+	$(APP_SRC_PATH1)/trulib/c5soc/tru_c5soc_hps_clkmgr_ll.c \
+	$(wildcard $(HOST_SRC_PATH)/*.c)
+
+HOST_CFLAGS := -std=gnu11 -O2 -g -Wall -DTRU_CFG_CPU_FAMILY=TRU_CPU_FAMILY_HOST $(HOST_INC)
+HOST_LDFLAGS :=
+ifeq ($(san),1)
+HOST_CFLAGS += -fsanitize=address,undefined -fno-omit-frame-pointer -fno-sanitize-recover=undefined
+HOST_LDFLAGS += -fsanitize=address,undefined
+endif
+
+HOST_OBJ := $(addprefix $(HOST_OUT_PATH)/,$(notdir $(HOST_SRC:.c=.o)))
+
+vpath %.c $(sort $(dir $(HOST_SRC)))
+
+.PHONY: all run clean help
+
+all: $(HOST_ELF)
+
+help:
+	@echo "Builds trulib as a native host program with simulated peripherals"
+	@echo "Usage:"
+	@echo "  make -f Makefile-host.mk [targets] [options]"
+	@echo ""
+	@echo "Targets:"
+	@echo "  all           Build the host program (default)"
+	@echo "  run           Build and run the host program"
+	@echo "  clean         Delete all built files"
+	@echo "Options to use with target:"
+	@echo "  san=0         Build without the address and undefined behaviour sanitizers"
+	@echo "  CC=clang      Use a different compiler"
+
+run: $(HOST_ELF)
+	$(HOST_ELF)
+
+$(HOST_ELF): $(HOST_OBJ)
+	$(CC) $(HOST_LDFLAGS) -o $@ $^
+
+$(HOST_OUT_PATH)/%.o: %.c | $(HOST_OUT_PATH)
+	$(CC) $(HOST_CFLAGS) -MMD -MP -c -o $@ $<
+
+$(HOST_OUT_PATH):
+	mkdir -p $@
+
+clean:
+	rm -rf $(HOST_OUT_PATH)
+
+-include $(HOST_OBJ:.o=.d)
@@ -0,0 +1,28 @@
+#!/bin/bash
+# Runs app1 on the QEMU vexpress-a9 machine, e.g. for the benchmarks:
+#   make release qemu=1 bench=1
+#   runqemu.sh release > bench.log
+#   ../scripts-py/bench_compare.py baseline.log bench.log
+#
+# The UART0 output is printed to the standard output.  QEMU exits when the
+# application exits (requires Semihosting, which is enabled here).
+# "-icount shift=0" makes the global timer count instructions, so the
+# results are repeatable on any host.
+
+set -e
+
+if [ -z "${APP_HOME_PATH+x}" ]; then
+	chmod +x ../scripts-env/env-linux.sh
+	source ../scripts-env/env-linux.sh
+fi
+
+cd $APP_HOME_PATH
+
+# Determine build from input argument
+if [ "$1" = "debug" ]; then
+	app1_elf="$APP_OUT_PATH/DebugApp1/$APP_PROGRAM_NAME1".elf
+else
+	app1_elf="$APP_OUT_PATH/ReleaseApp1/$APP_PROGRAM_NAME1".elf
+fi
+
+timeout ${QEMU_TIMEOUT:-120} qemu-system-arm -M vexpress-a9 -smp 1 -m 1G -nographic -monitor none -serial stdio -icount shift=0 -semihosting-config enable=on,target=native -kernel $app1_elf
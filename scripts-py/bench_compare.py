@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# This is free script released into the public domain.
+# Python script v20261019 created by Truong Hy.
+#
+# Compares the benchmark results (tru_bench_run_all) of a run against a
+# baseline and reports the regressions, e.g. for a CI job running the
+# benchmarks on QEMU.
+#
+# Usage:
+#   bench_compare.py <baseline log> <log> [threshold percent] [key]
+#
+# The logs are the captured UART (or Semihosting) text, other lines are
+# ignored.  The key is the result compared, min (default), med or avg.
+# The default threshold is 5 percent.  Exit code is 1 if a benchmark is
+# slower than the baseline by more than the threshold, or is missing.
+
+import re
+import sys
+
+BENCH_RE = re.compile(r'BENCH (\S+) unit=(\S+) hz=(\d+) ((?:\w+=\d+ ?)+)')
+
+def parse(path):
+	results = {}
+	with open(path, 'r', errors='replace') as f:
+		for line in f:
+			m = BENCH_RE.search(line)
+			if m:
+				fields = dict(kv.split('=') for kv in m.group(4).split())
+				fields = {k: int(v) for k, v in fields.items()}
+				fields['unit'] = m.group(2)
+				results[m.group(1)] = fields
+	return results
+
+def main():
+	if len(sys.argv) < 3:
+		print('Usage: bench_compare.py <baseline log> <log> [threshold percent] [key]')
+		sys.exit(2)
+
+	threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 5.0
+	key = sys.argv[4] if len(sys.argv) > 4 else 'min'
+
+	base = parse(sys.argv[1])
+	cur = parse(sys.argv[2])
+	if not base:
+		print('No benchmark results found in ' + sys.argv[1])
+		sys.exit(2)
+
+	failed = 0
+	print('%-32s %12s %12s %8s' % ('Benchmark', 'Baseline', 'Current', 'Change'))
+	for name in sorted(base):
+		if name not in cur:
+			print('%-32s %12d %12s %8s  MISSING' % (name, base[name][key], '-', '-'))
+			failed += 1
+			continue
+		b = base[name][key]
+		c = cur[name][key]
+		if base[name]['unit'] != cur[name]['unit']:
+			print('%-32s units differ (%s, %s)' % (name, base[name]['unit'], cur[name]['unit']))
+			failed += 1
+			continue
+		change = (c - b) * 100.0 / b if b else 0.0
+		status = ''
+		if change > threshold:
+			status = '  REGRESSION'
+			failed += 1
+		elif change < -threshold:
+			status = '  improved'
+		print('%-32s %12d %12d %+7.1f%%%s' % (name, b, c, change, status))
+	for name in sorted(set(cur) - set(base)):
+		print('%-32s %12s %12d %8s  new' % (name, '-', cur[name][key], '-'))
+
+	sys.exit(1 if failed else 0)
+
+if __name__ == '__main__':
+	main()
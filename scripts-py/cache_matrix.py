@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# This is free script released into the public domain.
+# Python script v20261019 created by Truong Hy.
+#
+# Builds and runs the benchmarks (bench=1) of app1 under every combination of
+# the cache and MMU startup settings, and prints a table of the slowdown of
+# each combination against all settings on.  It shows what a debug-friendly
+# setting costs, and the CACHECFG line of each run (tru_cache_print_config)
+# shows whether the hardware state matches the settings.
+#
+# Usage (from the repository folder, after sourcing scripts-env/env-linux.sh):
+#   cache_matrix.py [--values 0,1] [--debug] [--key med] [--out matrix] [--hw "<run command>"] [--parse]
+#
+#   --values  Values of each setting, 2 = left as the boot loader set it
+#   --debug   Debug build instead of release (DEBUG turns the caches off unless overridden)
+#   --key     Result compared: min, med (default) or avg
+#   --out     Folder of the builds (one APP_OUT_PATH per combination) and logs
+#   --hw      Build both apps for the DE10-Nano and run the command, which must load them and print the UART
+#             output to the standard output.  APP_OUT_PATH is set to the build of the combination.
+#             Default is QEMU (scripts-linux/runqemu.sh)
+#   --parse   Only tabulate the logs of a previous run
+#
+# The settings are passed with the make option cfg, e.g. cfg="-DTRU_L1_CACHE=0U", which takes priority over the
+# user configuration.  The jitter benchmark is skipped (BENCH_JITTER_ITERS=0U) to keep the runs short.
+#
+# The state row is ok if the CACHECFG line matches the settings, else it lists the mismatches, e.g. l2! = the
+# L2 cache is off although set on, mmu+ = the MMU is on although set off.
+#
+# Note: QEMU does not model caches, so on QEMU the table only checks that every combination builds, runs and
+# reports the expected state.  Measure the timings on hardware.
+
+import itertools
+import math
+import os
+import re
+import subprocess
+import sys
+
+SETTINGS = ['L1_CACHE', 'L2_CACHE', 'MMU', 'SMP_COHERENCY']
+STATE_KEYS = {'L1_CACHE': 'dcache', 'L2_CACHE': 'l2', 'MMU': 'mmu', 'SMP_COHERENCY': 'smp'}
+BENCH_RE = re.compile(r'BENCH (\S+) unit=(\S+) hz=(\d+) ((?:\w+=\d+ ?)+)')
+CACHECFG_RE = re.compile(r'CACHECFG ((?:\w+=\w+ ?)+)')
+
+def combo_name(values):
+	return ''.join(str(v) for v in values)
+
+def combo_cfg(values):
+	cfg = ['-DTRU_%s=%uU' % (s, v) for s, v in zip(SETTINGS, values)]
+	return ' '.join(cfg + ['-DBENCH_JITTER_ITERS=0U'])
+
+def run(cmd, env, log=None):
+	print('> ' + cmd)
+	if log is None:
+		return subprocess.call(cmd, shell=True, env=env, cwd=env['APP_HOME_PATH'])
+	with open(log, 'w') as f:
+		return subprocess.call(cmd, shell=True, env=env, cwd=env['APP_HOME_PATH'], stdout=f, stderr=subprocess.STDOUT)
+
+def build_and_run(values, out, build, hw_cmd):
+	env = dict(os.environ)
+	env['APP_OUT_PATH'] = os.path.join(out, combo_name(values))
+	cfg = combo_cfg(values)
+	log = os.path.join(out, combo_name(values) + '.log')
+
+	if hw_cmd is None:
+		if run('make -f Makefile-app1.mk --no-print-directory %s bench=1 qemu=1 cfg="%s"' % (build, cfg), env) != 0:
+			return False
+		run('bash scripts-linux/runqemu.sh %s' % build, env, log)
+	else:
+		if run('make -f Makefile-app1.mk --no-print-directory %s bench=1 cfg="%s"' % (build, cfg), env) != 0:
+			return False
+		if run('make -f Makefile-app2.mk --no-print-directory %s cfg="%s"' % (build, cfg), env) != 0:
+			return False
+		run(hw_cmd, env, log)
+	return True
+
+def parse(path):
+	results = {}
+	state = None
+	if not os.path.isfile(path):
+		return results, state
+	with open(path, 'r', errors='replace') as f:
+		for line in f:
+			m = BENCH_RE.search(line)
+			if m:
+				fields = dict(kv.split('=') for kv in m.group(4).split())
+				results[m.group(1)] = {k: int(v) for k, v in fields.items()}
+				continue
+			m = CACHECFG_RE.search(line)
+			if m:
+				state = dict(kv.split('=') for kv in m.group(1).split())
+	return results, state
+
+# Returns the settings that the hardware state does not match, ? if there is no CACHECFG line
+def check_state(values, state):
+	if state is None:
+		return '?'
+	wrong = []
+	for s, v in zip(SETTINGS, values):
+		if v != 2 and int(state.get(STATE_KEYS[s], -1)) != v:
+			wrong.append(STATE_KEYS[s] + ('!' if v else '+'))
+	return ','.join(wrong) if wrong else 'ok'
+
+def main():
+	args = sys.argv[1:]
+	values = [0, 1]
+	build = 'release'
+	key = 'med'
+	out = 'matrix'
+	hw_cmd = None
+	parse_only = False
+
+	while args:
+		a = args.pop(0)
+		if a == '--values':
+			values = [int(v) for v in args.pop(0).split(',')]
+		elif a == '--debug':
+			build = 'debug'
+		elif a == '--key':
+			key = args.pop(0)
+		elif a == '--out':
+			out = args.pop(0)
+		elif a == '--hw':
+			hw_cmd = args.pop(0)
+		elif a == '--parse':
+			parse_only = True
+		else:
+			print('Usage: cache_matrix.py [--values 0,1] [--debug] [--key med] [--out matrix] [--hw "<run command>"] [--parse]')
+			sys.exit(2)
+
+	if 'APP_HOME_PATH' not in os.environ:
+		print('APP_HOME_PATH is not set, source scripts-env/env-linux.sh first')
+		sys.exit(2)
+	out = os.path.join(os.environ['APP_HOME_PATH'], out)
+	os.makedirs(out, exist_ok=True)
+
+	combos = list(itertools.product(values, repeat=len(SETTINGS)))
+	if not parse_only:
+		for c in combos:
+			if not build_and_run(c, out, build, hw_cmd):
+				print('Build failed: ' + combo_cfg(c))
+
+	logs = {c: parse(os.path.join(out, combo_name(c) + '.log')) for c in combos}
+	base = tuple(1 if 1 in values else max(values) for _ in SETTINGS)
+	if base not in logs or not logs[base][0]:
+		base = next((c for c in combos if logs[c][0]), None)
+	if base is None:
+		print('No benchmark results found in ' + out)
+		sys.exit(1)
+
+	# Table of the time relative to the base combination, > 1 is slower
+	names = sorted(logs[base][0])
+	width = max(len(n) for n in names + ['geomean'])
+	print('Columns: %s (0 = off, 1 = on, 2 = unchanged), %s relative to %s' % (' '.join(SETTINGS), key, combo_name(base)))
+	print('%-*s' % (width, 'Benchmark') + ''.join(' %8s' % combo_name(c) for c in combos))
+	print('%-*s' % (width, 'state') + ''.join(' %8s' % check_state(c, logs[c][1]) for c in combos))
+	logsum = {c: [0.0, 0] for c in combos}
+	for name in names:
+		b = logs[base][0][name].get(key, 0)
+		row = '%-*s' % (width, name)
+		for c in combos:
+			r = logs[c][0].get(name)
+			if r is None or b == 0 or r.get(key, 0) == 0:
+				row += ' %8s' % '-'
+				continue
+			ratio = r[key] / b
+			logsum[c][0] += math.log(ratio)
+			logsum[c][1] += 1
+			row += ' %8.2f' % ratio
+		print(row)
+	print('%-*s' % (width, 'geomean') + ''.join(' %8.2f' % math.exp(logsum[c][0] / logsum[c][1]) if logsum[c][1] else ' %8s' % '-' for c in combos))
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+# This is free script released into the public domain.
+# Python script v20261019 created by Truong Hy.
+#
+# Tabulates the jitter test results (tru_jitter_print) of a log, and
+# optionally plots the histograms as text.
+#
+# Usage:
+#   jitter_report.py <log> [--hist] [--us]
+#
+# The log is the captured UART (or Semihosting) text, other lines are
+# ignored.  --hist prints a bar chart of every histogram (log scale of the
+# counts, so that the rare outliers are visible).  --us converts the times
+# to microseconds using the hz field.
+
+import math
+import re
+import sys
+
+JITTER_RE = re.compile(r'JITTER (\S+) unit=(\S+) hz=(\d+) ((?:\w+=\d+ ?)+)')
+JHIST_RE = re.compile(r'JHIST (\S+) (\d+) (\d+)')
+COLUMNS = ['min', 'p50', 'p90', 'p99', 'p999', 'p9999', 'p999999', 'max']
+
+def parse(path):
+	results = {}
+	hists = {}
+	with open(path, 'r', errors='replace') as f:
+		for line in f:
+			m = JITTER_RE.search(line)
+			if m:
+				fields = dict(kv.split('=') for kv in m.group(4).split())
+				fields = {k: int(v) for k, v in fields.items()}
+				fields['unit'] = m.group(2)
+				fields['hz'] = int(m.group(3))
+				results[m.group(1)] = fields
+				hists[m.group(1)] = []
+				continue
+			m = JHIST_RE.search(line)
+			if m and m.group(1) in hists:
+				hists[m.group(1)].append((int(m.group(2)), int(m.group(3))))
+	return results, hists
+
+def conv(val, fields, us):
+	if us:
+		return '%.3f' % (val * 1000000.0 / fields['hz'])
+	return str(val)
+
+def print_hist(name, buckets, fields, us):
+	print()
+	print('%s (%s)' % (name, 'us' if us else fields['unit']))
+	peak = max(math.log10(c) + 1.0 for _, c in buckets)
+	for low, count in buckets:
+		bar = '#' * max(1, int(round((math.log10(count) + 1.0) * 50.0 / peak)))
+		print('%12s %10d %s' % (conv(low, fields, us), count, bar))
+
+def main():
+	if len(sys.argv) < 2:
+		print('Usage: jitter_report.py <log> [--hist] [--us]')
+		sys.exit(2)
+
+	us = '--us' in sys.argv
+	results, hists = parse(sys.argv[1])
+	if not results:
+		print('No jitter results found in ' + sys.argv[1])
+		sys.exit(2)
+
+	print('%-24s %10s ' % ('Test', 'Iters') + ' '.join('%10s' % c for c in COLUMNS) + ' %10s' % 'max/p50')
+	for name in results:
+		fields = results[name]
+		ratio = fields['max'] / fields['p50'] if fields['p50'] else 0.0
+		print('%-24s %10d ' % (name, fields['iters']) + ' '.join('%10s' % conv(fields[c], fields, us) for c in COLUMNS) + ' %10.2f' % ratio)
+
+	if '--hist' in sys.argv:
+		for name in results:
+			if hists[name]:
+				print_hist(name, hists[name], results[name], us)
+
+if __name__ == '__main__':
+	main()
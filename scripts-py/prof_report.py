@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+# This is free script released into the public domain.
+# Python script v20261019 created by Truong Hy.
+#
+# Turns the sampling profiler output (tru_prof_dump) into a flat profile and
+# folded stacks.
+#
+# The PC samples have no call stack, so the folded stacks are made from the
+# source file, the function and the chain of inlined functions at the PC
+# (from addr2line -i).  The flamegraph therefore groups by file and shows
+# where inlined code lands, the widths are exact sample counts.
+#
+# Usage:
+#   prof_report.py <elf> <log> [folded output file]
+#
+# The log is the captured UART (or Semihosting) text, other lines are ignored.
+# If the log contains dumps from both cores, each core is reported separately.
+# Create a flamegraph with: flamegraph.pl <folded output file> > prof.svg
+#
+# Requirements:
+#   - GCC ARM cross compiler toolchain (addr2line) in the search path, or set CROSS_COMPILE
+
+import os
+import re
+import subprocess
+import sys
+
+BEGIN_RE = re.compile(r'PROF BEGIN core=(\d+) base=0x([0-9a-fA-F]+) shift=(\d+) rate=(\d+) samples=(\d+) outside=(\d+)')
+BIN_RE = re.compile(r'PROF ([0-9a-fA-F]+) (\d+)')
+
+def parse(path):
+	dumps = []
+	cur = None
+	with open(path, 'r', errors='replace') as f:
+		for line in f:
+			line = line.strip()
+			m = BEGIN_RE.search(line)
+			if m:
+				cur = {
+					'core': int(m.group(1)),
+					'base': int(m.group(2), 16),
+					'shift': int(m.group(3)),
+					'rate': int(m.group(4)),
+					'samples': int(m.group(5)),
+					'outside': int(m.group(6)),
+					'bins': {}
+				}
+				continue
+			if cur is None:
+				continue
+			if 'PROF END' in line:
+				dumps.append(cur)
+				cur = None
+				continue
+			m = BIN_RE.search(line)
+			if m:
+				addr = cur['base'] + (int(m.group(1), 16) << cur['shift'])
+				cur['bins'][addr] = cur['bins'].get(addr, 0) + int(m.group(2))
+	return dumps
+
+def symbolize(elf, addrs):
+	# Returns addr -> list of (function, file:line) from outermost to innermost
+	tool = os.environ.get('CROSS_COMPILE', 'arm-none-eabi-') + 'addr2line'
+	# A sentinel address after each query marks the end of its inline chain
+	inp = ''.join('0x%x\n0\n' % a for a in addrs)
+	out = subprocess.run([tool, '-f', '-i', '-C', '-e', elf], input=inp, capture_output=True, text=True, check=True).stdout.splitlines()
+
+	result = {}
+	i = 0
+	for a in addrs:
+		frames = []
+		while i + 1 < len(out):
+			func, loc = out[i], out[i + 1]
+			i += 2
+			if func == '??' and loc.startswith('??:0'):
+				break  # Sentinel
+			frames.append((func, loc))
+		if not frames:
+			frames = [('??', '??:0')]
+		frames.reverse()  # addr2line prints the innermost first
+		result[a] = frames
+	return result
+
+def main():
+	if len(sys.argv) < 3:
+		print('Usage: ' + os.path.basename(sys.argv[0]) + ' <elf> <log> [folded output file]')
+		return 1
+
+	elf, log = sys.argv[1], sys.argv[2]
+	folded_path = sys.argv[3] if len(sys.argv) > 3 else log + '.folded'
+	dumps = parse(log)
+	if not dumps:
+		print('No profiler dump found in ' + log)
+		return 1
+
+	addrs = sorted(set(a for d in dumps for a in d['bins']))
+	syms = symbolize(elf, addrs) if addrs else {}
+
+	folded = {}
+	for d in dumps:
+		total = d['samples'] if d['samples'] else 1
+		print('Core %d: %d samples at %d Hz, %d outside .text, bin size %d bytes' % (d['core'], d['samples'], d['rate'], d['outside'], 1 << d['shift']))
+
+		# Flat profile by function (the outermost, not inlined, function)
+		flat = {}
+		for addr, count in d['bins'].items():
+			func = syms[addr][0][0]
+			flat[func] = flat.get(func, 0) + count
+		print('%8s %7s  %s' % ('Samples', '%', 'Function'))
+		for func, count in sorted(flat.items(), key=lambda x: x[1], reverse=True):
+			print('%8d %6.2f%%  %s' % (count, 100.0 * count / total, func))
+		print('')
+
+		# Folded stacks: core;file;function;inlined..
+		for addr, count in d['bins'].items():
+			frames = syms[addr]
+			file = os.path.basename(frames[0][1].split(':')[0])
+			key = ';'.join(['core' + str(d['core']), file] + [f for f, l in frames])
+			folded[key] = folded.get(key, 0) + count
+		if d['outside']:
+			key = 'core' + str(d['core']) + ';[outside .text]'
+			folded[key] = folded.get(key, 0) + d['outside']
+
+	with open(folded_path, 'w') as f:
+		for key, count in sorted(folded.items()):
+			f.write(key + ' ' + str(count) + '\n')
+	print('Folded stacks written to ' + folded_path)
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# This is free script released into the public domain.
+# Python script v20261019 created by Truong Hy.
+#
+# Static worst-case stack usage report from the GCC call graph files.
+#
+# The sources must be compiled with: -fstack-usage -fcallgraph-info=su
+# GCC then writes a .ci (VCG call graph) file next to each object file.  This
+# script merges all of them into one call graph and sums the frame sizes along
+# the deepest path of each function.
+#
+# Usage:
+#   stack_usage.py <object folder> [top]
+#
+# Limitations:
+#   - Indirect calls (function pointers) are not followed, they are flagged
+#   - Recursion is not followed, it is flagged
+#   - Functions with dynamic stack (alloca or VLA) are flagged
+#   - Library functions (e.g. newlib) are not compiled with the flags, so they count as 0 bytes
+
+import os
+import re
+import sys
+
+NODE_RE = re.compile(r'node:\s*\{\s*title:\s*"([^"]*)"\s*label:\s*"([^"]*)"')
+EDGE_RE = re.compile(r'edge:\s*\{\s*sourcename:\s*"([^"]*)"\s*targetname:\s*"([^"]*)"')
+SIZE_RE = re.compile(r'\\n(\d+) bytes \(([^)]*)\)')
+
+class Func:
+	def __init__(self, title):
+		self.title = title
+		self.name = title
+		self.loc = ''
+		self.size = 0
+		self.qual = ''
+		self.defined = False
+		self.calls = set()
+
+def load(path):
+	funcs = {}
+	def get(title):
+		if title not in funcs:
+			funcs[title] = Func(title)
+		return funcs[title]
+
+	for root, dirs, files in os.walk(path):
+		for file in files:
+			if not file.endswith('.ci'):
+				continue
+			with open(os.path.join(root, file), 'r') as f:
+				text = f.read()
+			for title, label in NODE_RE.findall(text):
+				fn = get(title)
+				parts = label.split('\\n')
+				m = SIZE_RE.search(label)
+				if m:
+					fn.name = parts[0]
+					fn.loc = parts[1] if len(parts) > 1 else ''
+					fn.size = int(m.group(1))
+					fn.qual = m.group(2)
+					fn.defined = True
+			for src, dst in EDGE_RE.findall(text):
+				get(src).calls.add(dst)
+				get(dst)
+	return funcs
+
+def worst(funcs):
+	result = {}  # title -> (total, flags, path)
+	visiting = set()
+
+	def walk(title):
+		if title in result:
+			return result[title]
+		fn = funcs[title]
+		if title in visiting:
+			return (0, {'recursive'}, [])
+		visiting.add(title)
+		flags = set()
+		if fn.qual != 'static' and fn.defined:
+			flags.add(fn.qual)
+		best = (0, set(), [])
+		for callee in fn.calls:
+			if callee == '__indirect_call':
+				flags.add('indirect')
+				continue
+			sub = walk(callee)
+			flags |= sub[1]
+			if sub[0] >= best[0]:
+				best = sub
+		visiting.discard(title)
+		result[title] = (fn.size + best[0], flags, [title] + best[2])
+		return result[title]
+
+	for title in funcs:
+		walk(title)
+	return result
+
+def main():
+	if len(sys.argv) < 2:
+		print('Usage: ' + os.path.basename(sys.argv[0]) + ' <object folder> [top]')
+		return 1
+
+	top = int(sys.argv[2]) if len(sys.argv) > 2 else 20
+	funcs = load(sys.argv[1])
+	if not funcs:
+		print('No .ci files found, compile with: -fstack-usage -fcallgraph-info=su')
+		return 1
+	result = worst(funcs)
+
+	# Sort by worst-case total
+	rows = sorted((t for t in funcs if funcs[t].defined), key=lambda t: result[t][0], reverse=True)
+
+	print('Worst-case stack usage (bytes), own frame included:')
+	print('%8s %8s  %-32s %s' % ('Total', 'Frame', 'Function', 'Flags'))
+	for t in rows[:top]:
+		fn = funcs[t]
+		print('%8d %8d  %-32s %s' % (result[t][0], fn.size, fn.name, ','.join(sorted(result[t][1]))))
+
+	# Entry points of interest
+	for entry in ('main', 'IRQ_Handler', 'FIQ_Handler', 'Reset_Handler'):
+		if entry in funcs and funcs[entry].defined:
+			total, flags, path = result[entry]
+			print('')
+			print('Deepest path from ' + entry + ': ' + str(total) + ' bytes' + (' (' + ','.join(sorted(flags)) + ')' if flags else ''))
+			for t in path:
+				print('  %6d  %s %s' % (funcs[t].size, funcs[t].name, funcs[t].loc))
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
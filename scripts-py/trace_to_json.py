@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# This is free script released into the public domain.
+# Python script v20261019 created by Truong Hy.
+#
+# Converts the function entry/exit tracer output (tru_trace_dump) into the
+# Chrome trace event JSON format, which can be opened with chrome://tracing or
+# https://ui.perfetto.dev.
+#
+# Each core is shown as a separate thread.  The timestamps are from the global
+# timer, which is shared by both cores, so the two timelines line up.
+#
+# Usage:
+#   trace_to_json.py <log> <app1 elf> [app2 elf] [json output file]
+#
+# The log is the captured UART (or Semihosting) text, other lines are ignored.
+# The app1 elf is used to name the functions of core 0, the app2 elf for core 1.
+# The default output file is trace.json.
+#
+# Requirements:
+#   - GCC ARM cross compiler toolchain (nm) in the search path, or set CROSS_COMPILE
+
+import json
+import os
+import re
+import subprocess
+import sys
+
+BEGIN_RE = re.compile(r'TRACE BEGIN core=(\d+) hz=(\d+) count=(\d+) dropped=(\d+)')
+ENTRY_RE = re.compile(r'TRACE ([EX]) ([0-9a-fA-F]{8}) ([0-9a-fA-F]{16})')
+
+def parse(path):
+	dumps = []
+	cur = None
+	with open(path, 'r', errors='replace') as f:
+		for line in f:
+			line = line.strip()
+			m = BEGIN_RE.search(line)
+			if m:
+				cur = {
+					'core': int(m.group(1)),
+					'hz': int(m.group(2)),
+					'dropped': int(m.group(4)),
+					'entries': []
+				}
+				continue
+			if cur is None:
+				continue
+			if 'TRACE END' in line:
+				dumps.append(cur)
+				cur = None
+				continue
+			m = ENTRY_RE.search(line)
+			if m:
+				cur['entries'].append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+	return dumps
+
+# Returns a dictionary of function address to name
+def read_symbols(elf):
+	tool = os.environ.get('CROSS_COMPILE', 'arm-none-eabi-') + 'nm'
+	out = subprocess.run([tool, '-C', elf], stdout=subprocess.PIPE, universal_newlines=True, check=True).stdout
+	syms = {}
+	for line in out.splitlines():
+		parts = line.split(None, 2)
+		if len(parts) == 3 and parts[1] in 'tTwW':
+			syms.setdefault(int(parts[0], 16), parts[2])
+	return syms
+
+def convert(dump, syms):
+	events = []
+	depth = 0
+	for kind, fn, ts in dump['entries']:
+		if kind == 'E':
+			depth += 1
+			ph = 'B'
+		else:
+			# The ring may have overwritten the entry of an outer function, skip its exit
+			if depth == 0:
+				continue
+			depth -= 1
+			ph = 'E'
+		events.append({
+			'name': syms.get(fn, '0x%08x' % fn),
+			'ph': ph,
+			'ts': ts * 1e6 / dump['hz'],
+			'pid': 0,
+			'tid': dump['core']
+		})
+	return events
+
+def main():
+	if len(sys.argv) < 3:
+		print('Usage: trace_to_json.py <log> <app1 elf> [app2 elf] [json output file]')
+		sys.exit(1)
+
+	elfs = [sys.argv[2]]
+	out_path = 'trace.json'
+	for arg in sys.argv[3:]:
+		if arg.endswith('.json'):
+			out_path = arg
+		else:
+			elfs.append(arg)
+
+	dumps = parse(sys.argv[1])
+	if not dumps:
+		print('No trace dump found in ' + sys.argv[1])
+		sys.exit(1)
+
+	syms = [read_symbols(elf) for elf in elfs]
+	events = [{'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': core, 'args': {'name': 'core%d' % core}} for core in sorted(set(d['core'] for d in dumps))]
+	for dump in dumps:
+		core_syms = syms[dump['core']] if dump['core'] < len(syms) else {}
+		events.extend(convert(dump, core_syms))
+		print('Core %d: %d entries, %d dropped' % (dump['core'], len(dump['entries']), dump['dropped']))
+
+	with open(out_path, 'w') as f:
+		json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, f)
+	print('Written ' + out_path)
+
+if __name__ == '__main__':
+	main()
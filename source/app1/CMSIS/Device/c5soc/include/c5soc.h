@@ -210,11 +210,21 @@ typedef enum IRQn
   C5SOC_RAM_ECC_UNCORRECTED_IRQ_IRQn = 211
 } IRQn_Type;
 
+#if(TRU_BOARD == TRU_BOARD_QEMU_VEXPRESSA9)
+// Arm components, but with QEMU vexpress-a9 assigned base address
+#define SCU_BASE                   0x1E000000UL  // SCU register base address
+#define L2C_310_BASE               0x1E00A000UL  // L2 cache register base address
+#define GIC_DISTRIBUTOR_BASE       0x1E001000UL  // GIC distributor register base address
+#define TIMER_BASE                 0x1E000600UL  // Private high resolution timer register base address
+#define GIC_INTERFACE_BASE         0x1E000100UL  // GIC CPU interface register base address
+#else
 // Arm components, but with Cyclone V SoC assigned base address
+#define SCU_BASE                   0xFFFEC000UL  // SCU register base address
 #define L2C_310_BASE               0xFFFEF000UL  // L2 cache register base address
 #define GIC_DISTRIBUTOR_BASE       0xFFFED000UL  // GIC distributor register base address
 #define TIMER_BASE                 0xFFFEC600UL  // Private high resolution timer register base address
 #define GIC_INTERFACE_BASE         0xFFFEC100UL  // GIC CPU interface register base address
+#endif
 
 /* ========================================================================= */
 /* ============      Processor and Core Peripheral Section      ============ */
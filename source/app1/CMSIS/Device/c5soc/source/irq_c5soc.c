@@ -24,6 +24,14 @@
 #include "c5soc.h"
 #include <stddef.h>
 
+#if defined(TRU_PROF) && TRU_PROF == 1U
+	#include "arm/tru_prof.h"
+#endif
+
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+	#include "arm/tru_irq_stats.h"
+#endif
+
 // Define CMSIS IRQ handler table (see irq_ctrl_gic.h)
 IRQHandler_t IRQTable[IRQ_GIC_LINE_COUNT] = { 0U };
 
@@ -48,6 +56,17 @@ int32_t IRQ_Initialize(void){
 
 // Overrride CMSIS default weak prototype (see irq_ctrl_gic.h)
 void __attribute__((interrupt("IRQ"))) IRQ_Handler(void){
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+	tru_irq_entry_ts = gtim_get_counter_low();  // Entry time for latency measurement, read first to keep it close to the exception entry
+#endif
+
+#if defined(TRU_PROF) && TRU_PROF == 1U
+	// Capture the interrupted PC for the sampling profiler.  LR cannot be read with inline assembly here because the compiler may use it as a scratch
+	// register after saving it.  The builtin gives the entry value of LR, which the compiler generated entry code has already adjusted with
+	// "SUB lr, lr, #4" (LR is always pushed because this function makes calls), so it is the return address
+	tru_prof_irq_pc = (uint32_t)__builtin_return_address(0);
+#endif
+
 	// Save floating point registers (VFP registers)
 #if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
 	__ASM volatile(
@@ -61,8 +80,16 @@ void __attribute__((interrupt("IRQ"))) IRQ_Handler(void){
 
 	IRQn_ID_t irq_id = IRQ_GetActiveIRQ();  // Get ID of the triggered interrupt
 
-	if((irq_id >= 0U) && (irq_id < (IRQn_ID_t)IRQ_GIC_LINE_COUNT)){
-		IRQTable[irq_id]();  // Call the user registered IRQ handler
+	IRQn_ID_t irqn = irq_id & 0x3FFU;  // Ignore CPUID field (software generated interrupts), otherwise an SGI from core 1 is out of range
+
+	if((irqn >= 0U) && (irqn < (IRQn_ID_t)IRQ_GIC_LINE_COUNT)){
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+		uint32_t start = gtim_get_counter_low();
+		IRQTable[irqn]();  // Call the user registered IRQ handler
+		tru_irq_stats_add(irqn, gtim_get_counter_low() - start);
+#else
+		IRQTable[irqn]();  // Call the user registered IRQ handler
+#endif
 	}
 
 	int32_t status = IRQ_EndOfInterrupt(irq_id);  // Set interrupt is serviced
@@ -147,6 +147,11 @@ MMU_L1_SECTION uint8_t mmu_ttb_l1[L1_SIZE];
 	extern uint32_t __dma_buffer_end;  // Reference external symbol name from the linker file
 #endif
 
+#if defined(TRU_MMU) && TRU_MMU == 1U
+	extern uint32_t __amp_shared_start;  // Reference external symbol name from the linker file
+	extern uint32_t __amp_shared_end;  // Reference external symbol name from the linker file
+#endif
+
 void *mmu_get_ttb_l1(void){
 	return mmu_ttb_l1;
 }
@@ -200,6 +205,9 @@ void *mmu_get_ttb_l1(void){
 		MMU_TTSection((uint32_t *)mmu_ttb_l1, C5SOC_PERI_L3_BASE, 12U, L1_Section_Attrib_Device_RW);  // Define 1MB sections for the combined regions peripherals/L3, BootROM, SCU/L2 and OCRAM
 		// -----------------------
 		// Total L1 entries = 4096
+#if(TRU_BOARD == TRU_BOARD_QEMU_VEXPRESSA9)
+		MMU_TTSection((uint32_t *)mmu_ttb_l1, 0x10000000UL, 256U, L1_Section_Attrib_Device_RW);  // QEMU vexpress-a9: remap the motherboard and Arm peripherals region (0x10000000 - 0x1FFFFFFF) as device
+#endif
 
 		/* Set location of level 1 page table.  Bit assignments:
 				31:14 - Translation table base addr (31:14-TTBCR.N, TTBCR.N is 0 out of reset)
@@ -442,42 +450,95 @@ void *mmu_get_ttb_l1(void){
 	}
 #endif
 
-#if defined(TRU_DMA_BUFFER_NONCACHEABLE) && TRU_DMA_BUFFER_NONCACHEABLE == 1U && defined(TRU_MMU) && TRU_MMU == 1U
+#if defined(TRU_MMU) && TRU_MMU == 1U
+	// Replaces the 1MB section entries of a range with the new attributes.  The caller must clean and invalidate the caches for the range, if it was cacheable
 	// Note: this assumes the MMU table is using L1 entries with 1MB sections
-	void mmu_create_dma_buffer_table_entries(void){
-		uint32_t dma_buffer_size = &__dma_buffer_end - &__dma_buffer_start;
-
-		if(dma_buffer_size){
-			mmu_region_attributes_Type region = {
-				.rg_t = SECTION,
-				.domain = 0x0,
-				.e_t = ECC_DISABLED,
-				.g_t = GLOBAL,
-				.inner_norm_t = NON_CACHEABLE,  // L1 cache
-				.outer_norm_t = NON_CACHEABLE,  // L2 cache
-				.mem_t = NORMAL,
-				.sec_t = SECURE,
-				.xn_t = EXECUTE,
-				.priv_t = RW,
-				.user_t = RW,
-				.sh_t = SHARED
-			};
-			uint32_t L1_Section_Attrib_NonCache_RWX;  // Section attribute variable
-			uint32_t noncache_num_sections = (dma_buffer_size % 1048576UL) ? dma_buffer_size / 1048576UL + 1 : dma_buffer_size / 1048576UL;  // Calc number of 1MB MMU sections rounding up
+	static void mmu_remap_table_entries(uint32_t base, uint32_t size, mmu_region_attributes_Type region){
+		if(size){
+			uint32_t L1_Section_Attrib;  // Section attribute variable
+			uint32_t num_sections = (size % 1048576UL) ? size / 1048576UL + 1 : size / 1048576UL;  // Calc number of 1MB MMU sections rounding up
 			uint32_t *mmu_ttb_l1 = mmu_get_ttb_l1();
 
-			MMU_GetSectionDescriptor(&L1_Section_Attrib_NonCache_RWX, region);  // Fill section attribute variable
-			MMU_TTSection(mmu_ttb_l1, (uint32_t)&__dma_buffer_start, noncache_num_sections, DESCRIPTOR_FAULT);  // Replace the old translation table entry with an invalid (faulting) entry
+			MMU_GetSectionDescriptor(&L1_Section_Attrib, region);  // Fill section attribute variable
+			MMU_TTSection(mmu_ttb_l1, base, num_sections, DESCRIPTOR_FAULT);  // Replace the old translation table entry with an invalid (faulting) entry
 			// Clean not required with the Multiprocessing Extensions
 			//uint32_t offset = (uint32_t)stream0.xfer_addr >> 20U;
-			//tru_l1_data_clean_range(mmu_ttb_l1 + offset, 4U * noncache_num_sections);
+			//tru_l1_data_clean_range(mmu_ttb_l1 + offset, 4U * num_sections);
 			__DSB();  // Ensure faulting entry is visible
-			MMU_InvalidateRange(mmu_ttb_l1, (uint32_t)&__dma_buffer_start, noncache_num_sections);  // Invalidate TLB entries by MVA with Multiprocessing Extension support
+			MMU_InvalidateRange(mmu_ttb_l1, base, num_sections);  // Invalidate TLB entries by MVA with Multiprocessing Extension support
 			__set_BPIALL(0);  // Invalidate entire branch predictor array
 			__DSB();  // Ensure completion of the invalidate branch predictor operation
 			__ISB();  // Ensure changes visible to instruction fetch
-			MMU_TTSection(mmu_ttb_l1, (uint32_t)&__dma_buffer_start, noncache_num_sections, L1_Section_Attrib_NonCache_RWX);  // Write MMU table 1MB section entries that are non-cacheable
+			MMU_TTSection(mmu_ttb_l1, base, num_sections, L1_Section_Attrib);  // Write MMU table 1MB section entries with the new attributes
 			__DSB();  // Ensure the new entry is visible
 		}
 	}
+
+	// Remaps a range as normal non-cacheable memory
+	void mmu_create_noncache_table_entries(uint32_t base, uint32_t size){
+		mmu_region_attributes_Type region = {
+			.rg_t = SECTION,
+			.domain = 0x0,
+			.e_t = ECC_DISABLED,
+			.g_t = GLOBAL,
+			.inner_norm_t = NON_CACHEABLE,  // L1 cache
+			.outer_norm_t = NON_CACHEABLE,  // L2 cache
+			.mem_t = NORMAL,
+			.sec_t = SECURE,
+			.xn_t = EXECUTE,
+			.priv_t = RW,
+			.user_t = RW,
+			.sh_t = SHARED
+		};
+		mmu_remap_table_entries(base, size, region);
+	}
+
+	// Remaps a range as shared device memory, e.g. for measuring the access time of device memory backed by SDRAM
+	void mmu_create_device_table_entries(uint32_t base, uint32_t size){
+		mmu_region_attributes_Type region = {
+			.rg_t = SECTION,
+			.domain = 0x0,
+			.e_t = ECC_DISABLED,
+			.g_t = GLOBAL,
+			.inner_norm_t = NON_CACHEABLE,
+			.outer_norm_t = NON_CACHEABLE,
+			.mem_t = SHARED_DEVICE,
+			.sec_t = SECURE,
+			.xn_t = NON_EXECUTE,
+			.priv_t = RW,
+			.user_t = RW,
+			.sh_t = SHARED
+		};
+		mmu_remap_table_entries(base, size, region);
+	}
+
+	// Remaps a range back to the default SDRAM attributes (normal, inner & outer write-back write-allocate)
+	void mmu_create_normal_table_entries(uint32_t base, uint32_t size){
+		mmu_region_attributes_Type region = {
+			.rg_t = SECTION,
+			.domain = 0x0,
+			.e_t = ECC_DISABLED,
+			.g_t = GLOBAL,
+			.inner_norm_t = WB_WA,  // L1 cache
+			.outer_norm_t = WB_WA,  // L2 cache
+			.mem_t = NORMAL,
+			.sec_t = SECURE,
+			.xn_t = EXECUTE,
+			.priv_t = RW,
+			.user_t = RW,
+			.sh_t = SHARED
+		};
+		mmu_remap_table_entries(base, size, region);
+	}
+
+	// Memory shared between the cores (see arm/tru_amp_shared.h)
+	void mmu_create_amp_shared_table_entries(void){
+		mmu_create_noncache_table_entries((uint32_t)&__amp_shared_start, (uint32_t)&__amp_shared_end - (uint32_t)&__amp_shared_start);
+	}
+#endif
+
+#if defined(TRU_DMA_BUFFER_NONCACHEABLE) && TRU_DMA_BUFFER_NONCACHEABLE == 1U && defined(TRU_MMU) && TRU_MMU == 1U
+	void mmu_create_dma_buffer_table_entries(void){
+		mmu_create_noncache_table_entries((uint32_t)&__dma_buffer_start, (uint32_t)&__dma_buffer_end - (uint32_t)&__dma_buffer_start);
+	}
 #endif
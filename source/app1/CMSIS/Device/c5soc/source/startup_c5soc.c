@@ -24,6 +24,7 @@
 
 #include <c5soc.h>
 #include <core_ca.h>
+#include "arm/tru_boot_prof.h"
 
 #if defined(TRU_EXIT_TO_UBOOT) && TRU_EXIT_TO_UBOOT == 1U
   #define RESET_ARGS int argc, char *const argv[]
@@ -42,6 +43,50 @@
 #define UND_MODE 0x1BU            // Undefined Instruction mode
 #define SYS_MODE 0x1FU            // System mode
 
+#define STRINGIFY_(x) #x
+#define STRINGIFY(x)  STRINGIFY_(x)
+
+#if defined(TRU_BOOT_PROF) && TRU_BOOT_PROF == 1U
+  // Boot time profiler (see arm/tru_boot_prof.h).  Global timer base address
+  #define BOOT_PROF_GTIM_BASE STRINGIFY(SCU_BASE) " + 0x200"
+
+  // Enable the global timer if it is not running, uses r0 and r1
+  #define BOOT_PROF_TIMER_ENABLE \
+  "LDR    r0, =" BOOT_PROF_GTIM_BASE "                 \n"  /* Load global timer base address */ \
+  "LDR    r1, [r0, #0x8]                           \n"  /* Read global timer control register */ \
+  "ORR    r1, r1, #0x1                             \n"  /* Set bit 0 (timer enable) */ \
+  "STR    r1, [r0, #0x8]                           \n"  /* Write back modified value */
+
+  // Read the global timer counter low word into reg
+  #define BOOT_PROF_READ(reg) \
+  "LDR    " #reg ", =" BOOT_PROF_GTIM_BASE "                 \n"  /* Load global timer base address */ \
+  "LDR    " #reg ", [" #reg "]                             \n"  /* Read counter low register */
+
+  // Store reg into the boot log of this core, uses r0 (left pointing to the log) and r1.  reg must not be r0 or r1
+  #define BOOT_PROF_STORE(phase, reg) \
+  "MRC    p15, 0, r0, c0, c0, 5                    \n"  /* Read MPIDR */ \
+  "AND    r0, r0, #3                               \n"  /* Processor number */ \
+  "LDR    r1, =" STRINGIFY(TRU_BOOT_LOG_SIZE) "                    \n"  /* Size of a log */ \
+  "MUL    r0, r0, r1                               \n"  /* Offset of the log of this core */ \
+  "LDR    r1, =tru_amp_shared                      \n"  /* The logs are at the start of the shared memory */ \
+  "ADD    r0, r0, r1                               \n"  /* Address of the log of this core */ \
+  "STR    " #reg ", [r0, #(" STRINGIFY(TRU_BOOT_LOG_TS_OFFSET) " + 4 * " STRINGIFY(phase) ")]              \n"  /* Store time stamp */
+
+  // Time stamp the end of a phase, uses r0 to r2
+  #define BOOT_PROF_MARK(phase) BOOT_PROF_READ(r2) BOOT_PROF_STORE(phase, r2)
+
+  // Mark the log as written, must follow BOOT_PROF_STORE or BOOT_PROF_MARK
+  #define BOOT_PROF_VALID \
+  "LDR    r1, =" STRINGIFY(TRU_BOOT_LOG_MAGIC) "                   \n"  /* Load magic value */ \
+  "STR    r1, [r0]                                 \n"  /* Store into the log */
+#else
+  #define BOOT_PROF_TIMER_ENABLE
+  #define BOOT_PROF_READ(reg)
+  #define BOOT_PROF_STORE(phase, reg)
+  #define BOOT_PROF_MARK(phase)
+  #define BOOT_PROF_VALID
+#endif
+
 /*----------------------------------------------------------------------------
   Internal References
  *----------------------------------------------------------------------------*/
@@ -132,6 +177,10 @@ void Reset_Handler(RESET_ARGS) {
   "STR r2, [r3]                                    \n"
 #endif
 
+  // Boot time profiler: keep the reset time stamp in r4 until the caches are off, because U-Boot may have left them on
+  BOOT_PROF_TIMER_ENABLE
+  BOOT_PROF_READ(r4)
+
   // Put any cores other than 0 to sleep
 	/*
   "MRC     p15, 0, R0, c0, c0, 5                   \n"  // Read MPIDR
@@ -155,6 +204,8 @@ void Reset_Handler(RESET_ARGS) {
 #endif
 
 "_disable_l1:                                      \n"
+  BOOT_PROF_READ(r5)  // Cache clean time stamp, kept in r5 until the caches are off
+
   // Reset SCTLR Settings
   "MRC     p15, 0, R0, c1, c0, 0                   \n"  // Read CP15 System Control register
 #if defined(TRU_L1_CACHE) && TRU_L1_CACHE != 2U
@@ -184,6 +235,23 @@ void Reset_Handler(RESET_ARGS) {
   "LDR    R0, =Vectors                             \n"
   "MCR    p15, 0, R0, c12, c0, 0                   \n"
 
+  // Store the earlier time stamps now that the caches are off
+  BOOT_PROF_STORE(TRU_BOOT_PHASE_RESET, r4)
+  BOOT_PROF_STORE(TRU_BOOT_PHASE_CLEAN_CACHE, r5)
+  BOOT_PROF_MARK(TRU_BOOT_PHASE_SCTLR)
+  BOOT_PROF_VALID
+
+#if defined(TRU_STACK_PAINT) && TRU_STACK_PAINT == 1U
+  // Paint all mode stacks with a known pattern for stack usage measurement (see tru_stack.h)
+  "LDR    r0, =Image$$FIQ_STACK$$ZI$$Base          \n"  // Lowest stack address
+  "LDR    r1, =Image$$SYS_STACK$$ZI$$Limit         \n"  // Highest stack address
+  "LDR    r2, =0xa5a5a5a5                          \n"  // Pattern, must match with TRU_STACK_PAINT_PATTERN
+"_paint_stack:                                     \n"
+  "CMP    r0, r1                                   \n"
+  "STRLO  r2, [r0], #4                             \n"
+  "BLO    _paint_stack                             \n"
+#endif
+
   // Setup Stack for each exceptional mode
   "CPS    #0x11                                    \n"
   "LDR    SP, =Image$$FIQ_STACK$$ZI$$Limit         \n"
@@ -197,6 +265,7 @@ void Reset_Handler(RESET_ARGS) {
   "LDR    SP, =Image$$UND_STACK$$ZI$$Limit         \n"
   "CPS    #0x1F                                    \n"
   "LDR    SP, =Image$$SYS_STACK$$ZI$$Limit         \n"
+  BOOT_PROF_MARK(TRU_BOOT_PHASE_STACKS)
 
   // Call SystemInit
   "BL     SystemInit                               \n"
@@ -207,12 +276,12 @@ void Reset_Handler(RESET_ARGS) {
   // =======================================
 
   // Invalidate SCU
-  "LDR    r0, =0xfffec000UL                        \n"  // Load SCU base register
+  "LDR    r0, =" STRINGIFY(SCU_BASE) "               \n"  // Load SCU base register
   "LDR    r1, =0xffff                              \n"  // Value to write
-  "STR    r1, [r0, #0xc]                           \n"  // Write to SCU Invalidate All register (0xfffec00c)
+  "STR    r1, [r0, #0xc]                           \n"  // Write to SCU Invalidate All register (SCU_BASE + 0xc)
 
   // Enable SCU
-  "LDR    r0, =0xfffec000UL                        \n"  // Load SCU base register
+  "LDR    r0, =" STRINGIFY(SCU_BASE) "               \n"  // Load SCU base register
   "LDR    r1, [r0, #0x0]                           \n"  // Read SCU register
   "ORR    r1, r1, #0x1                             \n"  // Set bit 0 (The Enable bit)
   "STR    r1, [r0, #0x0]                           \n"  // Write back modified value
@@ -227,6 +296,7 @@ void Reset_Handler(RESET_ARGS) {
   "ORR    r0, r0, #(0x1 << 0)                      \n"  // Set bit 0 to enable maintenance broadcast
   "MCR    p15, 0, r0, c1, c0, 1                    \n"  // Write ACTLR
 #endif
+  BOOT_PROF_MARK(TRU_BOOT_PHASE_SCU)
 
   // Unmask interrupts
   "CPSIE  if                                       \n"
@@ -0,0 +1,57 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Benchmarks of trulib, built with the bench=1 make option.
+*/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+// Number of untimed calls before the timed runs
+#define BENCH_WARMUP 4U
+
+// Number of timed runs per benchmark
+#define BENCH_RUNS 32U
+
+// Optional FPGA RAM behind the H2F bridge (0xC0000000) and the LW H2F bridge (0xFF200000) for the
+// memory benchmarks.  The bridge must be enabled and RAM must exist in the FPGA design, 0 = skip
+#define BENCH_MEM_H2F_BASE   0xc0000000UL
+#define BENCH_MEM_H2F_SIZE   0U
+#define BENCH_MEM_LWH2F_BASE 0xff200000UL
+#define BENCH_MEM_LWH2F_SIZE 0U
+
+// Number of calls of the jitter test kernel per interference load, 0 = skip
+#ifndef BENCH_JITTER_ITERS
+	#define BENCH_JITTER_ITERS 1000000U
+#endif
+
+void bench_main(void);
+void bench_mem_main(void);
+void bench_memcpy_main(void);
+void bench_cache_main(void);
+void bench_prefetch_main(void);
+void bench_jitter_main(void);
+
+#endif
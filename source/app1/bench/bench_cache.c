@@ -0,0 +1,226 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cache maintenance benchmarks on DMA sized buffers.
+
+	The L2 range operations of tru_cache.h, which issue one cache sync per
+	range, are compared with the per-line CMSIS functions, which issue one
+	per line.  The size-adaptive functions and the DMA sync functions (L1 +
+	L2) are compared with the separate L1 and L2 range operations.  The buffer is not dirtied between the calls,
+	so the times are the cost of the maintenance operations themselves.
+*/
+
+#include "bench.h"
+
+// Trulib includes
+#include "tru_config.h"
+#include "tru_cache.h"
+#include "arm/tru_bench.h"
+
+// Arm CMSIS includes
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#define KB 1024U
+#define MB (1024U * 1024U)
+
+#define CACHE_MAX_SIZE (4U * MB)
+
+typedef struct{
+	uint8_t *buf;
+	uint32_t size;
+}cache_arg_t;
+
+static const uint32_t sizes[] = { 64U * KB, 1U * MB, CACHE_MAX_SIZE };
+
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+
+// ================
+// L2 range, 1 sync
+// ================
+
+static void l2_clean(void *arg){
+	cache_arg_t *c = arg;
+	tru_l2_data_clean_range(c->buf, c->size);
+}
+
+static void l2_inv(void *arg){
+	cache_arg_t *c = arg;
+	tru_l2_data_inv_range(c->buf, c->size);
+}
+
+static void l2_cleaninv(void *arg){
+	cache_arg_t *c = arg;
+	tru_l2_data_cleaninv_range(c->buf, c->size);
+}
+
+// =======================
+// L2 per line, CMSIS sync
+// =======================
+
+static void l2_clean_perline(void *arg){
+	cache_arg_t *c = arg;
+	for(uint32_t offset = 0U; offset < c->size; offset += CACHELINE_SIZE) L2C_CleanPa(&c->buf[offset]);
+	__DSB();
+}
+
+static void l2_inv_perline(void *arg){
+	cache_arg_t *c = arg;
+	for(uint32_t offset = 0U; offset < c->size; offset += CACHELINE_SIZE) L2C_InvPa(&c->buf[offset]);
+	__DSB();
+}
+
+static void l2_cleaninv_perline(void *arg){
+	cache_arg_t *c = arg;
+	for(uint32_t offset = 0U; offset < c->size; offset += CACHELINE_SIZE) L2C_CleanInvPa(&c->buf[offset]);
+	__DSB();
+}
+
+typedef struct{
+	const char *name;
+	tru_bench_func_t func;
+}cache_kernel_t;
+
+static const cache_kernel_t kernels[] = {
+	{ "l2_clean",            l2_clean },
+	{ "l2_clean_perline",    l2_clean_perline },
+	{ "l2_inv",              l2_inv },
+	{ "l2_inv_perline",      l2_inv_perline },
+	{ "l2_cleaninv",         l2_cleaninv },
+	{ "l2_cleaninv_perline", l2_cleaninv_perline }
+};
+
+#endif
+
+// ========================
+// L1 + L2, range, adaptive
+// ========================
+
+static void l1l2_clean(void *arg){
+	cache_arg_t *c = arg;
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	tru_l1_data_clean_range(c->buf, c->size);
+#endif
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	tru_l2_data_clean_range(c->buf, c->size);
+#endif
+}
+
+static void l1l2_clean_adaptive(void *arg){
+	cache_arg_t *c = arg;
+	tru_cache_data_clean_range(c->buf, c->size);
+}
+
+static void l1l2_cleaninv(void *arg){
+	cache_arg_t *c = arg;
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	tru_l1_data_cleaninv_range(c->buf, c->size);
+#endif
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	tru_l2_data_cleaninv_range(c->buf, c->size);
+#endif
+}
+
+static void l1l2_cleaninv_adaptive(void *arg){
+	cache_arg_t *c = arg;
+	tru_cache_data_cleaninv_range(c->buf, c->size);
+}
+
+static void l1l2_inv(void *arg){
+	cache_arg_t *c = arg;
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	tru_l2_data_inv_range(c->buf, c->size);
+#endif
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	tru_l1_data_inv_range(c->buf, c->size);
+#endif
+}
+
+static void dma_for_device(void *arg){
+	cache_arg_t *c = arg;
+	tru_dma_sync_for_device(c->buf, c->size, TRU_DMA_TO_DEVICE);
+}
+
+static void dma_for_cpu(void *arg){
+	cache_arg_t *c = arg;
+	tru_dma_sync_for_cpu(c->buf, c->size, TRU_DMA_FROM_DEVICE);
+}
+
+typedef struct{
+	const char *name;
+	tru_bench_func_t func;
+}adaptive_kernel_t;
+
+static const adaptive_kernel_t adaptive_kernels[] = {
+	{ "l1l2_clean",             l1l2_clean },
+	{ "l1l2_clean_adaptive",    l1l2_clean_adaptive },
+	{ "l1l2_cleaninv",          l1l2_cleaninv },
+	{ "l1l2_cleaninv_adaptive", l1l2_cleaninv_adaptive },
+	{ "l1l2_inv",               l1l2_inv },
+	{ "l1l2_clean_dma_sync",    dma_for_device },
+	{ "l1l2_inv_dma_sync",      dma_for_cpu }
+};
+
+void bench_cache_main(void){
+	char name[48];
+	tru_bench_result_t result;
+	uint8_t *buf = memalign(CACHELINE_SIZE, CACHE_MAX_SIZE);
+
+	if(buf == NULL) return;
+	memset(buf, 0, CACHE_MAX_SIZE);
+
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	for(uint32_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+		cache_arg_t arg = { .buf = buf, .size = sizes[s] };
+		for(uint32_t k = 0U; k < sizeof(kernels) / sizeof(kernels[0]); k++){
+			snprintf(name, sizeof(name), "%s_%" PRIu32 "k", kernels[k].name, sizes[s] / KB);
+			tru_bench_t bench = { .name = name, .func = kernels[k].func, .arg = &arg, .bytes = sizes[s] };
+			tru_bench_run(&bench, 1U, BENCH_RUNS / 4U, &result);
+			tru_bench_print(&bench, &result);
+		}
+	}
+#endif
+
+	printf("CACHE thresholds l1=%" PRIu32 " l2=%" PRIu32 "\n", tru_cache_thresholds.l1, tru_cache_thresholds.l2);
+	for(uint32_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+		cache_arg_t arg = { .buf = buf, .size = sizes[s] };
+		for(uint32_t k = 0U; k < sizeof(adaptive_kernels) / sizeof(adaptive_kernels[0]); k++){
+			snprintf(name, sizeof(name), "%s_%" PRIu32 "k", adaptive_kernels[k].name, sizes[s] / KB);
+			tru_bench_t bench = { .name = name, .func = adaptive_kernels[k].func, .arg = &arg, .bytes = sizes[s] };
+			tru_bench_run(&bench, 1U, BENCH_RUNS / 4U, &result);
+			tru_bench_print(&bench, &result);
+		}
+	}
+
+	free(buf);
+}
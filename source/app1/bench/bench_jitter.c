@@ -0,0 +1,173 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Jitter (timing determinism) test of a fixed workload, with and without
+	interference from core 1.
+
+	The kernel is called BENCH_JITTER_ITERS times with IRQs masked, so the
+	distribution shows only the effect of the shared resources (L2 cache,
+	SCU, L3 interconnect and SDRAM controller) on the core.  Replace
+	jitter_kernel() with the workload of the real-time application.
+
+	The interference, if app2 is built with TRU_CFG_AMP_LOAD = 1U:
+		idle  : core 1 waits in WFE
+		ddr   : core 1 streams to SDRAM
+		thrash: core 1 evicts the shared L2 cache
+		irq   : core 1 interrupts itself with SGIs back to back
+
+	A second kernel reads a working set that is larger than the L1 cache
+	but fits in half of the L2 cache.  It is run under the ddr and thrash
+	loads, first with the L2 cache shared and then partitioned (_part) with
+	lockdown by master, core 0 and core 1 each allocating into half of the
+	ways.  The max and the high percentiles show the worst-case gain.
+
+	The FIR kernel and its data are in the .fast section, so with
+	TRU_CFG_L2_PIN_FAST = 1U they are pinned into the L2 cache and the thrash
+	load cannot evict them.
+*/
+
+#include "bench.h"
+
+// Trulib includes
+#include "tru_config.h"
+#include "arm/tru_jitter.h"
+#include "arm/tru_amp_load.h"
+#include "arm/tru_cache_l2c310.h"
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+
+#define JITTER_TAPS      32U
+#define JITTER_SAMPLES   16U
+#define JITTER_TIMEOUT   100000U  // us
+#define JITTER_WS_SIZE   (96U * 1024U)
+#define JITTER_WS_ITERS  (BENCH_JITTER_ITERS / 100U)  // The working set kernel is about 100 times slower
+
+typedef struct{
+	const char *name;
+	tru_amp_load_mode_t mode;
+}jitter_load_t;
+
+static const jitter_load_t loads[] = {
+	{ "idle",   TRU_AMP_LOAD_IDLE },
+	{ "ddr",    TRU_AMP_LOAD_DDR_STREAM },
+	{ "thrash", TRU_AMP_LOAD_CACHE_THRASH },
+	{ "irq",    TRU_AMP_LOAD_IRQ_STORM }
+};
+
+static int32_t coeffs[JITTER_TAPS] TRU_FASTDATA;
+static int32_t input[JITTER_SAMPLES + JITTER_TAPS] TRU_FASTDATA;
+static int32_t output[JITTER_SAMPLES] TRU_FASTDATA;
+static uint32_t ws_buf[JITTER_WS_SIZE / sizeof(uint32_t)] __attribute__((aligned(32)));
+static volatile uint32_t ws_sink;
+static tru_jitter_hist_t hist;  // Too large for the stack
+
+// A FIR filter, as an example of a fixed control or signal processing workload
+TRU_FASTCODE static void jitter_kernel(void *arg){
+	for(uint32_t i = 0U; i < JITTER_SAMPLES; i++){
+		int64_t acc = 0;
+		for(uint32_t t = 0U; t < JITTER_TAPS; t++) acc += (int64_t)input[i + t] * coeffs[t];
+		output[i] = (int32_t)(acc >> 16);
+	}
+}
+
+// Reads one word of every cache line of the working set
+static void ws_kernel(void *arg){
+	uint32_t sum = 0U;
+	for(uint32_t i = 0U; i < JITTER_WS_SIZE / sizeof(uint32_t); i += 8U) sum += ws_buf[i];
+	ws_sink = sum;
+}
+
+// Runs the working set kernel under the memory loads, with the L2 cache shared or partitioned
+static void ws_run(const char *suffix){
+	char name[32];
+
+	for(uint32_t i = 0U; i < sizeof(loads) / sizeof(loads[0]); i++){
+		if(loads[i].mode != TRU_AMP_LOAD_DDR_STREAM && loads[i].mode != TRU_AMP_LOAD_CACHE_THRASH) continue;
+		if(tru_amp_load_set(loads[i].mode, 0U, JITTER_TIMEOUT) != 0) continue;
+
+		snprintf(name, sizeof(name), "ws%uk_%s%s", JITTER_WS_SIZE / 1024U, loads[i].name, suffix);
+		tru_jitter_t jitter = { .name = name, .func = ws_kernel };
+		tru_jitter_run(&jitter, JITTER_WS_ITERS, &hist);
+		tru_jitter_print(&jitter, &hist);
+	}
+	tru_amp_load_set(TRU_AMP_LOAD_IDLE, 0U, JITTER_TIMEOUT);
+}
+
+static void ws_main(void){
+	uint32_t d_ways[2];
+	uint32_t i_ways[2];
+	uint32_t num_ways = tru_l2c310_get_num_ways();
+	uint32_t all = (1U << num_ways) - 1U;
+	uint32_t lower = (1U << (num_ways / 2U)) - 1U;
+	uint32_t upper = all & ~lower;
+
+	for(uint32_t cpu = 0U; cpu < 2U; cpu++) tru_l2c310_get_lockdown(cpu, &d_ways[cpu], &i_ways[cpu]);
+
+	// Shared, the pinned ways stay locked
+	tru_l2c310_set_ways(0U, all);
+	tru_l2c310_set_ways(1U, all);
+	ws_run("");
+
+	// Partitioned
+	tru_l2c310_set_ways(0U, lower);
+	tru_l2c310_set_ways(1U, upper);
+	ws_run("_part");
+
+	for(uint32_t cpu = 0U; cpu < 2U; cpu++) tru_l2c310_set_lockdown(cpu, d_ways[cpu], i_ways[cpu]);
+}
+
+void bench_jitter_main(void){
+	char name[32];
+	bool load_ready = tru_amp_load_is_ready(JITTER_TIMEOUT);
+
+	for(uint32_t i = 0U; i < JITTER_TAPS; i++) coeffs[i] = (int32_t)(65536U / JITTER_TAPS);
+	for(uint32_t i = 0U; i < JITTER_SAMPLES + JITTER_TAPS; i++) input[i] = (int32_t)(i * 7919U % 4096U);
+
+	if(!load_ready) printf("JITTER core 1 load generator is not running, set TRU_CFG_AMP_LOAD = 1U in app2\n");
+
+	for(uint32_t i = 0U; i < sizeof(loads) / sizeof(loads[0]); i++){
+		if(loads[i].mode != TRU_AMP_LOAD_IDLE){
+			if(!load_ready) break;
+			if(tru_amp_load_set(loads[i].mode, 0U, JITTER_TIMEOUT) != 0){
+				printf("JITTER core 1 did not switch to the %s load\n", loads[i].name);
+				continue;
+			}
+		}
+
+		snprintf(name, sizeof(name), "fir%u_%s", JITTER_TAPS, loads[i].name);
+		tru_jitter_t jitter = { .name = name, .func = jitter_kernel };
+		tru_jitter_run(&jitter, BENCH_JITTER_ITERS, &hist);
+		tru_jitter_print(&jitter, &hist);
+	}
+
+	if(load_ready){
+		tru_amp_load_set(TRU_AMP_LOAD_IDLE, 0U, JITTER_TIMEOUT);
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+		ws_main();
+#endif
+	}
+}
@@ -0,0 +1,141 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Benchmarks of trulib, built with the bench=1 make option.
+
+	Each benchmark function repeats the operation a fixed number of times
+	(the _xN suffix in the name), so the time is well above the timer
+	resolution.
+*/
+
+#include "bench.h"
+
+// Trulib includes
+#include "tru_config.h"
+#include "arm/tru_bench.h"
+#include "arm/tru_sched.h"
+#include "arm/tru_time.h"
+#include "arm/tru_timer.h"
+
+// Standard includes
+#include <stdint.h>
+#include <string.h>
+
+#define BENCH_BUF_SIZE 4096U
+#define BENCH_TIMERS   16U
+
+static uint8_t src_buf[BENCH_BUF_SIZE] __attribute__((aligned(32)));
+static uint8_t dst_buf[BENCH_BUF_SIZE] __attribute__((aligned(32)));
+static tru_timer_t timers[BENCH_TIMERS];
+static volatile uint64_t sink;
+
+// ==========
+// Time base
+// ==========
+
+static void bench_time_ns(void *arg){
+	for(uint32_t i = 0U; i < 100U; i++) sink = tru_time_ns();
+}
+
+static void bench_time_conv(void *arg){
+	for(uint32_t i = 0U; i < 100U; i++) sink = tru_time_ticks_to_ns(i * 1000003U);
+}
+
+// ============
+// Timer heap
+// ============
+
+static void timer_func(void *arg){
+}
+
+// Starts timers with shuffled expiries and stops them in a different order.  The expiries are far away, so the timers never fire
+static void bench_timer_start_stop(void *arg){
+	for(uint32_t i = 0U; i < BENCH_TIMERS; i++){
+		tru_timer_start(&timers[i], tru_time_base.hz + ((i * 7U) % BENCH_TIMERS) * 1000U, 0U);
+	}
+	for(uint32_t i = 0U; i < BENCH_TIMERS; i++){
+		tru_timer_stop(&timers[(i * 5U) % BENCH_TIMERS]);
+	}
+}
+
+// ==========
+// Scheduler
+// ==========
+
+static void sched_func(void *arg, uint32_t events){
+}
+
+static void bench_sched_post_dispatch(void *arg){
+	for(uint32_t i = 0U; i < 100U; i++){
+		tru_sched_post(0U, 1U);
+		tru_sched_dispatch();
+	}
+}
+
+// ======
+// Memory
+// ======
+
+static void bench_memcpy(void *arg){
+	memcpy(dst_buf, src_buf, BENCH_BUF_SIZE);
+}
+
+static void bench_memset(void *arg){
+	memset(dst_buf, 0x5a, BENCH_BUF_SIZE);
+}
+
+static const tru_bench_t benches[] = {
+	{ .name = "time_ns_x100",             .func = bench_time_ns },
+	{ .name = "time_conv_x100",           .func = bench_time_conv },
+	{ .name = "timer_start_stop_x16",     .func = bench_timer_start_stop },
+	{ .name = "sched_post_dispatch_x100", .func = bench_sched_post_dispatch },
+	{ .name = "memcpy_4k",                .func = bench_memcpy, .bytes = BENCH_BUF_SIZE },
+	{ .name = "memset_4k",                .func = bench_memset, .bytes = BENCH_BUF_SIZE }
+};
+
+void bench_main(void){
+	if(!tru_timer_service_is_init()) tru_timer_service_init(0U);
+	for(uint32_t i = 0U; i < BENCH_TIMERS; i++) tru_timer_init(&timers[i], timer_func, NULL);
+	tru_sched_task_init(0U, sched_func, NULL, 0U);
+
+	for(uint32_t i = 0U; i < sizeof(benches) / sizeof(benches[0]); i++){
+		tru_bench_register(&benches[i]);
+	}
+	tru_bench_run_all(BENCH_WARMUP, BENCH_RUNS);
+
+	tru_sched_task_deinit(0U);
+
+	bench_mem_main();
+#if defined(TRU_NEON) && TRU_NEON == 1U
+	bench_memcpy_main();
+#endif
+	bench_cache_main();
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	bench_prefetch_main();
+#endif
+#if BENCH_JITTER_ITERS
+	bench_jitter_main();
+#endif
+}
@@ -0,0 +1,281 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Memory bandwidth (STREAM) and latency (pointer-chase) benchmarks.
+
+	The STREAM kernels run on double arrays, as the original STREAM benchmark:
+		copy : a[i] = b[i]
+		scale: a[i] = q * b[i]
+		add  : a[i] = b[i] + c[i]
+		triad: a[i] = b[i] + q * c[i]
+	The pointer-chase follows a random cyclic list with one node per cache
+	line, so every load depends on the previous one and the prefetchers cannot
+	help.  The latency of one load is printed in a MEMLAT line after the BENCH
+	line.
+
+	Array sizes (each of the three arrays) are chosen to fit in the L1 cache
+	(32KB), the L2 cache (512KB) and not to fit (SDRAM).  They run on these
+	memory types, where the type allows:
+		wbwa : SDRAM, normal inner & outer write-back write-allocate (the default MMU setting)
+		nc   : SDRAM, the .dma_buffer section (normal non-cacheable with TRU_CFG_DMA_BUFFER_NONCACHEABLE = 1U)
+		dev  : SDRAM, remapped as shared device for the test
+		ocram: on-chip RAM, with the attributes of the MMU table in use (not on QEMU)
+		h2f  : H2F bridge window, if set in bench.h (needs RAM in the FPGA)
+		lwh2f: LW H2F bridge window, if set in bench.h (needs RAM in the FPGA)
+
+	Everything is run a second time with app2 running the DDR streaming load
+	on core 1 (names end with _c1ddr), if app2 is built with
+	TRU_CFG_AMP_LOAD = 1U.
+*/
+
+#include "bench.h"
+
+// Trulib includes
+#include "tru_config.h"
+#include "tru_cache.h"
+#include "arm/tru_bench.h"
+#include "arm/tru_time.h"
+#include "arm/tru_amp_load.h"
+
+// Arm CMSIS includes
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#define KB 1024U
+#define MB (1024U * 1024U)
+
+#define MEM_MAX_SIZE    (4U * MB)    // Largest array size
+#define MEM_NC_SIZE     (128U * KB)  // Array size in the .dma_buffer section
+#define MEM_DEV_SIZE    (1U * MB)    // Remapped to device memory, holds the three arrays
+#define MEM_OCRAM_SIZE  (64U * KB)
+#define MEM_CHASE_LOADS 1024U        // Dependent loads per call
+#define MEM_AMP_TIMEOUT 100000U      // us
+
+typedef struct{
+	const char *name;
+	uint8_t *base;      // Three arrays, each max_size apart
+	uint32_t max_size;  // Largest array size
+}mem_region_t;
+
+typedef struct{
+	double *a;
+	double *b;
+	double *c;
+	uint32_t n;  // Elements per array
+}stream_arg_t;
+
+typedef struct{
+	void *start;
+}chase_arg_t;
+
+static const uint32_t sizes[] = { 8U * KB, 128U * KB, MEM_MAX_SIZE };
+static double nc_buf[3U * MEM_NC_SIZE / sizeof(double)] __attribute__((section(".dma_buffer"), aligned(32)));
+static volatile uintptr_t chase_sink;
+
+// ==============
+// STREAM kernels
+// ==============
+
+static void stream_copy(void *arg){
+	stream_arg_t *s = arg;
+	for(uint32_t i = 0U; i < s->n; i++) s->a[i] = s->b[i];
+}
+
+static void stream_scale(void *arg){
+	stream_arg_t *s = arg;
+	const double q = 3.0;
+	for(uint32_t i = 0U; i < s->n; i++) s->a[i] = q * s->b[i];
+}
+
+static void stream_add(void *arg){
+	stream_arg_t *s = arg;
+	for(uint32_t i = 0U; i < s->n; i++) s->a[i] = s->b[i] + s->c[i];
+}
+
+static void stream_triad(void *arg){
+	stream_arg_t *s = arg;
+	const double q = 3.0;
+	for(uint32_t i = 0U; i < s->n; i++) s->a[i] = s->b[i] + q * s->c[i];
+}
+
+typedef struct{
+	const char *name;
+	tru_bench_func_t func;
+	uint32_t arrays;  // Arrays accessed, for the bytes per call
+}stream_kernel_t;
+
+static const stream_kernel_t kernels[] = {
+	{ "copy",  stream_copy,  2U },
+	{ "scale", stream_scale, 2U },
+	{ "add",   stream_add,   3U },
+	{ "triad", stream_triad, 3U }
+};
+
+// =============
+// Pointer-chase
+// =============
+
+// Links one pointer per cache line into a random cycle (Sattolo's algorithm), returns the start
+static void *chase_build(uint8_t *buf, uint32_t size){
+	uint32_t n = size / CACHELINE_SIZE;
+	uint32_t *order = malloc(n * sizeof(uint32_t));
+	uint32_t seed = 12345U;
+
+	if(order == NULL) return NULL;
+	for(uint32_t i = 0U; i < n; i++) order[i] = i;
+	for(uint32_t i = n - 1U; i > 0U; i--){
+		seed = seed * 1664525U + 1013904223U;  // LCG, repeatable
+		uint32_t j = seed % i;
+		uint32_t tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+	for(uint32_t i = 0U; i < n; i++){
+		*(void **)&buf[order[i] * CACHELINE_SIZE] = &buf[order[(i + 1U) % n] * CACHELINE_SIZE];
+	}
+
+	void *start = &buf[order[0] * CACHELINE_SIZE];
+	free(order);
+	return start;
+}
+
+static void chase(void *arg){
+	chase_arg_t *c = arg;
+	void **p = c->start;
+
+	for(uint32_t i = 0U; i < MEM_CHASE_LOADS; i += 8U){
+		p = *p; p = *p; p = *p; p = *p;
+		p = *p; p = *p; p = *p; p = *p;
+	}
+	chase_sink = (uintptr_t)p;
+}
+
+// =======
+// Regions
+// =======
+
+static void run_region(const mem_region_t *region, const char *suffix){
+	char name[48];
+	tru_bench_result_t result;
+
+	for(uint32_t s = 0U; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+		uint32_t size = sizes[s];
+		if(size > region->max_size) continue;
+
+		// Bandwidth
+		stream_arg_t arg = {
+			.a = (double *)region->base,
+			.b = (double *)(region->base + region->max_size),
+			.c = (double *)(region->base + 2U * region->max_size),
+			.n = size / sizeof(double)
+		};
+		for(uint32_t i = 0U; i < arg.n; i++){
+			arg.a[i] = 1.0;
+			arg.b[i] = 2.0;
+			arg.c[i] = 0.5;
+		}
+		for(uint32_t k = 0U; k < sizeof(kernels) / sizeof(kernels[0]); k++){
+			snprintf(name, sizeof(name), "stream_%s_%s_%" PRIu32 "k%s", kernels[k].name, region->name, size / KB, suffix);
+			tru_bench_t bench = { .name = name, .func = kernels[k].func, .arg = &arg, .bytes = kernels[k].arrays * size };
+			tru_bench_run(&bench, BENCH_WARMUP, BENCH_RUNS, &result);
+			tru_bench_print(&bench, &result);
+		}
+
+		// Latency
+		chase_arg_t chase_arg = { .start = chase_build(region->base, size) };
+		if(chase_arg.start == NULL) continue;
+		snprintf(name, sizeof(name), "chase_%s_%" PRIu32 "k%s_x%u", region->name, size / KB, suffix, MEM_CHASE_LOADS);
+		tru_bench_t bench = { .name = name, .func = chase, .arg = &chase_arg };
+		tru_bench_run(&bench, BENCH_WARMUP, BENCH_RUNS, &result);
+		tru_bench_print(&bench, &result);
+#if defined(TRU_BENCH_PMU) && TRU_BENCH_PMU == 1U
+		printf("MEMLAT %s cycles_x100=%" PRIu32 "\n", name, (uint32_t)((uint64_t)result.median * 100U / MEM_CHASE_LOADS));
+#else
+		printf("MEMLAT %s ns_x100=%" PRIu64 "\n", name, tru_time_ticks_to_ns((uint64_t)result.median * 100U) / MEM_CHASE_LOADS);
+#endif
+	}
+}
+
+static void run_all_regions(const mem_region_t *regions, uint32_t num, const char *suffix){
+	for(uint32_t i = 0U; i < num; i++){
+		if(regions[i].base) run_region(&regions[i], suffix);
+	}
+}
+
+void bench_mem_main(void){
+	uint8_t *wbwa = memalign(CACHELINE_SIZE, 3U * MEM_MAX_SIZE);
+	uint8_t *dev = memalign(MB, MEM_DEV_SIZE);  // 1MB aligned, so it has its own MMU section
+	mem_region_t regions[6];
+	uint32_t num = 0U;
+
+	regions[num++] = (mem_region_t){ "wbwa", wbwa, MEM_MAX_SIZE };
+	regions[num++] = (mem_region_t){ "nc", (uint8_t *)nc_buf, MEM_NC_SIZE };
+#if defined(TRU_MMU) && TRU_MMU == 1U
+	if(dev){
+		// No dirty lines must be left behind for the remapped range
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+		tru_l1_data_cleaninv_range(dev, MEM_DEV_SIZE);
+#endif
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+		tru_l2_data_cleaninv_range(dev, MEM_DEV_SIZE);
+#endif
+		mmu_create_device_table_entries((uint32_t)dev, MEM_DEV_SIZE);
+		regions[num++] = (mem_region_t){ "dev", dev, MEM_DEV_SIZE / 4U };  // Three arrays must fit
+	}
+#endif
+#if(TRU_BOARD != TRU_BOARD_QEMU_VEXPRESSA9)
+	regions[num++] = (mem_region_t){ "ocram", (uint8_t *)C5SOC_OCRAM_BASE, MEM_OCRAM_SIZE / 4U };
+#endif
+#if BENCH_MEM_H2F_SIZE
+	regions[num++] = (mem_region_t){ "h2f", (uint8_t *)BENCH_MEM_H2F_BASE, BENCH_MEM_H2F_SIZE / 3U };
+#endif
+#if BENCH_MEM_LWH2F_SIZE
+	regions[num++] = (mem_region_t){ "lwh2f", (uint8_t *)BENCH_MEM_LWH2F_BASE, BENCH_MEM_LWH2F_SIZE / 3U };
+#endif
+
+	// Core 1 idle
+	run_all_regions(regions, num, "");
+
+	// Core 1 streaming to SDRAM
+	if(tru_amp_load_is_ready(MEM_AMP_TIMEOUT) && tru_amp_load_set(TRU_AMP_LOAD_DDR_STREAM, 0U, MEM_AMP_TIMEOUT) == 0){
+		run_all_regions(regions, num, "_c1ddr");
+		tru_amp_load_set(TRU_AMP_LOAD_IDLE, 0U, MEM_AMP_TIMEOUT);
+	}else{
+		printf("BENCH_MEM core 1 load generator is not running, set TRU_CFG_AMP_LOAD = 1U in app2\n");
+	}
+
+#if defined(TRU_MMU) && TRU_MMU == 1U
+	if(dev) mmu_create_normal_table_entries((uint32_t)dev, MEM_DEV_SIZE);
+#endif
+	free(dev);
+	free(wbwa);
+}
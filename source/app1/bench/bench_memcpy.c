@@ -0,0 +1,349 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	NEON memcpy, memmove and memset (arm/tru_mem.h) against newlib.
+
+	Each function is timed across sizes from 16 bytes to 4MB (larger than
+	the L2 cache), with the source aligned and misaligned by one byte (_u).
+	The small sizes are repeated (the _xN suffix) over a 64KB window, so the
+	time is well above the timer resolution.  With TRU_CFG_MEM_OVERRIDE = 1U
+	the newlib functions are replaced, so libc and tru are the same.
+
+	The copy into the non-cacheable .dma_buffer section compares
+	tru_memcpy_nt() with both memcpy functions.
+
+	The PLD distance of tru_memcpy() is swept on a 4MB copy and the fastest
+	is reported in a MEMCPY line, to set with TRU_CFG_MEM_PLD_DIST:
+		MEMCPY best_pld=<bytes>
+
+	Before the timing, the output of the trulib functions is checked against
+	byte loops, for the sizes 0 to 200 and around the 64 byte blocks, with
+	every source and destination offset 0 to 7, and memmove with overlaps in
+	both directions.  The bytes around the destination must be unchanged.
+	A mismatch prints FAILED and skips the timing:
+		MEMCPY verify PASSED checks=<n>
+		MEMCPY verify FAILED <function> size=<n> src_off=<n> dst_off=<n> shift=<memmove destination - source>
+*/
+
+#include "bench.h"
+
+// Trulib includes
+#include "tru_config.h"
+#include "arm/tru_bench.h"
+#include "arm/tru_mem.h"
+
+// Standard includes
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#if defined(TRU_NEON) && TRU_NEON == 1U
+
+#define MC_MAX_SIZE (4U * 1024U * 1024U)  // Larger than the L2 cache
+#define MC_WINDOW   (64U * 1024U)         // Bytes processed per call of the small sizes
+#define MC_NC_SIZE  (256U * 1024U)        // Destination size in the .dma_buffer section
+
+typedef struct{
+	uint8_t *dst;
+	const uint8_t *src;
+	uint32_t size;
+	uint32_t reps;
+}mc_arg_t;
+
+typedef struct{
+	const char *name;
+	tru_bench_func_t func;
+}mc_func_t;
+
+static const uint32_t sizes[] = { 16U, 64U, 256U, 1024U, 4096U, 65536U, 1048576U, MC_MAX_SIZE };
+static const uint32_t nc_sizes[] = { 4096U, 65536U, MC_NC_SIZE };
+static const uint32_t pld_dists[] = { 64U, 128U, 192U, 256U, 320U, 384U, 512U };
+
+static uint8_t nc_buf[MC_NC_SIZE] __attribute__((section(".dma_buffer"), aligned(32)));
+
+// ============
+// Verification
+// ============
+
+#define VF_SMALL_MAX 200U   // All sizes up to this are checked
+#define VF_BUF_SIZE  8192U  // Fits the largest size with the offsets, overlaps and guards
+#define VF_BASE      128U   // Start of the tested area, leaves guard bytes below it for the overlaps
+#define VF_GUARD     32U    // Bytes checked beyond the end
+#define VF_FILL      0xeeU
+#define VF_MAX_ERRORS 8U
+
+typedef enum{
+	VF_MEMCPY = 0,
+	VF_MEMCPY_NT,
+	VF_MEMMOVE,
+	VF_MEMSET,
+	VF_FUNC_COUNT
+}vf_func_t;
+
+static const char *const vf_names[VF_FUNC_COUNT] = { "memcpy", "memcpy_nt", "memmove", "memset" };
+
+// Around the 64 byte blocks and the PLD distance
+static const uint32_t vf_sizes[] = { 255U, 256U, 257U, 319U, 320U, 321U, 511U, 512U, 513U, 1023U, 1024U, 1025U, 4095U, 4096U, 4097U };
+
+// Overlaps of memmove, as multiples of 8 added to the difference of the offsets
+static const int32_t vf_shifts[] = { -64, -8, 0, 8, 64 };
+
+static uint8_t vf_src[VF_BUF_SIZE] __attribute__((aligned(32)));
+static uint8_t vf_dst[VF_BUF_SIZE] __attribute__((aligned(32)));
+static uint8_t vf_ref[VF_BUF_SIZE] __attribute__((aligned(32)));
+static uint32_t vf_checks;
+static uint32_t vf_errors;
+
+// The reference loops access through volatile pointers, so GCC cannot turn them into calls of the functions under test
+static void vf_ref_copy(uint8_t *dst, const uint8_t *src, uint32_t n){
+	volatile uint8_t *d = dst;
+	const volatile uint8_t *s = src;
+
+	if(d <= s){
+		for(uint32_t i = 0U; i < n; i++) d[i] = s[i];
+	}else{
+		for(uint32_t i = n; i > 0U; i--) d[i - 1U] = s[i - 1U];
+	}
+}
+
+static void vf_ref_fill(uint8_t *dst, uint8_t c, uint32_t n){
+	volatile uint8_t *d = dst;
+	for(uint32_t i = 0U; i < n; i++) d[i] = c;
+}
+
+static bool vf_ref_equal(const uint8_t *a, const uint8_t *b, uint32_t n){
+	const volatile uint8_t *va = a;
+	const volatile uint8_t *vb = b;
+
+	for(uint32_t i = 0U; i < n; i++){
+		if(va[i] != vb[i]) return false;
+	}
+	return true;
+}
+
+// Runs a function on vf_dst and the reference on vf_ref from the same start state, and compares the area including the guard bytes
+static void vf_check(vf_func_t func, uint32_t size, uint32_t src_off, uint32_t dst_off, int32_t shift){
+	uint32_t len = VF_BASE + 64U + size + 64U + VF_GUARD;  // The area that can be touched, with the largest shift
+	uint8_t *d = &vf_dst[VF_BASE + dst_off];
+	uint8_t *r = &vf_ref[VF_BASE + dst_off];
+	void *ret;
+
+	if(func == VF_MEMMOVE){
+		// Source and destination in the same buffer, filled with the pattern so a wrong direction shows
+		vf_ref_copy(vf_dst, vf_src, len);
+		vf_ref_copy(vf_ref, vf_src, len);
+		d = &vf_dst[VF_BASE + src_off + shift];
+		r = &vf_ref[VF_BASE + src_off + shift];
+		ret = tru_memmove(d, &vf_dst[VF_BASE + src_off], size);
+		vf_ref_copy(r, &vf_ref[VF_BASE + src_off], size);
+	}else{
+		vf_ref_fill(vf_dst, VF_FILL, len);
+		vf_ref_fill(vf_ref, VF_FILL, len);
+		if(func == VF_MEMCPY){
+			ret = tru_memcpy(d, &vf_src[src_off], size);
+			vf_ref_copy(r, &vf_src[src_off], size);
+		}else if(func == VF_MEMCPY_NT){
+			ret = tru_memcpy_nt(d, &vf_src[src_off], size);
+			vf_ref_copy(r, &vf_src[src_off], size);
+		}else{
+			ret = tru_memset(d, 0x15a, size);  // Only the low byte is stored
+			vf_ref_fill(r, 0x5aU, size);
+		}
+	}
+
+	vf_checks++;
+	if(ret != d || !vf_ref_equal(vf_dst, vf_ref, len)){
+		if(vf_errors < VF_MAX_ERRORS){
+			printf("MEMCPY verify FAILED %s size=%" PRIu32 " src_off=%" PRIu32 " dst_off=%" PRIu32 " shift=%" PRId32 "\n", vf_names[func], size, src_off, (uint32_t)d & 7U, shift);
+		}
+		vf_errors++;
+	}
+}
+
+static void vf_check_size(uint32_t size){
+	for(uint32_t src_off = 0U; src_off < 8U; src_off++){
+		for(uint32_t dst_off = 0U; dst_off < 8U; dst_off++){
+			vf_check(VF_MEMCPY, size, src_off, dst_off, 0);
+			vf_check(VF_MEMCPY_NT, size, src_off, dst_off, 0);
+			for(uint32_t i = 0U; i < sizeof(vf_shifts) / sizeof(vf_shifts[0]); i++){
+				vf_check(VF_MEMMOVE, size, src_off, dst_off, (int32_t)dst_off - (int32_t)src_off + vf_shifts[i]);
+			}
+		}
+		vf_check(VF_MEMSET, size, 0U, src_off, 0);
+	}
+}
+
+// Returns false on a mismatch
+static bool mc_verify(void){
+	vf_checks = 0U;
+	vf_errors = 0U;
+	for(uint32_t i = 0U; i < VF_BUF_SIZE; i++) vf_src[i] = (uint8_t)(i * 7U + (i >> 8U) * 13U + 1U);  // Does not repeat every 256 bytes
+
+	for(uint32_t size = 0U; size <= VF_SMALL_MAX; size++) vf_check_size(size);
+	for(uint32_t i = 0U; i < sizeof(vf_sizes) / sizeof(vf_sizes[0]); i++) vf_check_size(vf_sizes[i]);
+
+	if(vf_errors){
+		printf("MEMCPY verify FAILED errors=%" PRIu32 " checks=%" PRIu32 "\n", vf_errors, vf_checks);
+		return false;
+	}
+	printf("MEMCPY verify PASSED checks=%" PRIu32 "\n", vf_checks);
+	return true;
+}
+
+// =================
+// Benchmark kernels
+// =================
+
+static void mc_libc_memcpy(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) memcpy(a->dst, a->src, a->size);
+}
+
+static void mc_tru_memcpy(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) tru_memcpy(a->dst, a->src, a->size);
+}
+
+static void mc_tru_memcpy_nt(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) tru_memcpy_nt(a->dst, a->src, a->size);
+}
+
+// Overlapping, the destination is above the source
+static void mc_libc_memmove(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) memmove(a->dst, a->src, a->size);
+}
+
+static void mc_tru_memmove(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) tru_memmove(a->dst, a->src, a->size);
+}
+
+static void mc_libc_memset(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) memset(a->dst, 0x5a, a->size);
+}
+
+static void mc_tru_memset(void *arg){
+	mc_arg_t *a = arg;
+	for(uint32_t i = 0U; i < a->reps; i++) tru_memset(a->dst, 0x5a, a->size);
+}
+
+static const mc_func_t funcs[] = {
+	{ "memcpy_libc",  mc_libc_memcpy },
+	{ "memcpy_tru",   mc_tru_memcpy },
+	{ "memmove_libc", mc_libc_memmove },
+	{ "memmove_tru",  mc_tru_memmove },
+	{ "memset_libc",  mc_libc_memset },
+	{ "memset_tru",   mc_tru_memset }
+};
+
+static const mc_func_t nc_funcs[] = {
+	{ "memcpy_nc_libc",   mc_libc_memcpy },
+	{ "memcpy_nc_tru",    mc_tru_memcpy },
+	{ "memcpy_nc_tru_nt", mc_tru_memcpy_nt }
+};
+
+// ====
+// Main
+// ====
+
+static void mc_run(const char *name, tru_bench_func_t func, mc_arg_t *arg, tru_bench_result_t *result){
+	tru_bench_t bench = { .name = name, .func = func, .arg = arg, .bytes = arg->size * arg->reps };
+
+	tru_bench_run(&bench, 1U, BENCH_RUNS / 4U, result);
+	tru_bench_print(&bench, result);
+}
+
+void bench_memcpy_main(void){
+	char name[48];
+	tru_bench_result_t result;
+	uint32_t saved = tru_mem_pld_dist;
+	uint32_t best_pld = saved;
+	uint32_t best_ticks = UINT32_MAX;
+	uint8_t *buf;
+
+	if(!mc_verify()) return;  // The timing of a wrong result is meaningless
+
+	buf = memalign(32U, 2U * MC_MAX_SIZE + 32U);  // Source, destination and the memmove overlap
+	if(buf == NULL) return;
+	memset(buf, 1, 2U * MC_MAX_SIZE + 32U);
+
+	for(uint32_t f = 0U; f < sizeof(funcs) / sizeof(funcs[0]); f++){
+		bool is_move = strncmp(funcs[f].name, "memmove", 7U) == 0;
+
+		for(uint32_t i = 0U; i < sizeof(sizes) / sizeof(sizes[0]); i++){
+			for(uint32_t misalign = 0U; misalign < 2U; misalign++){
+				mc_arg_t arg = {
+					.src = &buf[misalign],
+					.dst = is_move ? &buf[misalign + 8U] : &buf[MC_MAX_SIZE + 32U],
+					.size = sizes[i],
+					.reps = (sizes[i] < MC_WINDOW) ? MC_WINDOW / sizes[i] : 1U
+				};
+
+				snprintf(name, sizeof(name), "%s_%" PRIu32 "%s_x%" PRIu32, funcs[f].name, sizes[i], misalign ? "_u" : "", arg.reps);
+				mc_run(name, funcs[f].func, &arg, &result);
+			}
+		}
+	}
+
+	for(uint32_t f = 0U; f < sizeof(nc_funcs) / sizeof(nc_funcs[0]); f++){
+		for(uint32_t i = 0U; i < sizeof(nc_sizes) / sizeof(nc_sizes[0]); i++){
+			mc_arg_t arg = {
+				.src = buf,
+				.dst = nc_buf,
+				.size = nc_sizes[i],
+				.reps = (nc_sizes[i] < MC_WINDOW) ? MC_WINDOW / nc_sizes[i] : 1U
+			};
+
+			snprintf(name, sizeof(name), "%s_%" PRIu32 "_x%" PRIu32, nc_funcs[f].name, nc_sizes[i], arg.reps);
+			mc_run(name, nc_funcs[f].func, &arg, &result);
+		}
+	}
+
+	// PLD distance sweep
+	for(uint32_t i = 0U; i < sizeof(pld_dists) / sizeof(pld_dists[0]); i++){
+		mc_arg_t arg = { .src = buf, .dst = &buf[MC_MAX_SIZE + 32U], .size = MC_MAX_SIZE, .reps = 1U };
+
+		tru_mem_pld_dist = pld_dists[i];
+		snprintf(name, sizeof(name), "memcpy_tru_pld%" PRIu32 "_%" PRIu32, pld_dists[i], MC_MAX_SIZE);
+		mc_run(name, mc_tru_memcpy, &arg, &result);
+		if(result.median < best_ticks){
+			best_ticks = result.median;
+			best_pld = pld_dists[i];
+		}
+	}
+	tru_mem_pld_dist = saved;
+	printf("MEMCPY best_pld=%" PRIu32 "\n", best_pld);
+
+	free(buf);
+}
+
+#endif
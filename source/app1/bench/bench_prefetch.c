@@ -0,0 +1,133 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	L2 cache prefetch sweep.
+
+	Runs a streaming workload (memcpy) and a random read workload, both on
+	buffers much larger than the L2 cache, with each prefetch setting and
+	reports the fastest setting of each workload in a PREFETCH line:
+		PREFETCH best_stream=<name> ctrl=<value> best_random=<name> ctrl=<value>
+	The prefetch setting is restored afterwards.
+*/
+
+#include "bench.h"
+
+// Trulib includes
+#include "tru_config.h"
+#include "arm/tru_bench.h"
+#include "arm/tru_cache_l2c310.h"
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#define PF_BUF_SIZE     (8U * 1024U * 1024U)  // Source and destination halves of 4MB
+#define PF_RANDOM_READS 4096U
+
+typedef struct{
+	const char *name;
+	uint32_t ctrl;
+}pf_setting_t;
+
+static const pf_setting_t settings[] = {
+	{ "off",          TRU_L2C310_PF_PRESET_OFF },
+	{ "random",       TRU_L2C310_PF_PRESET_RANDOM },
+	{ "balanced",     TRU_L2C310_PF_PRESET_BALANCED },
+	{ "stream",       TRU_L2C310_PF_PRESET_STREAM },
+	{ "d_o0",         TRU_L2C310_PF_DATA | TRU_L2C310_PF_OFFSET(0U) },
+	{ "d_o3",         TRU_L2C310_PF_DATA | TRU_L2C310_PF_OFFSET(3U) },
+	{ "d_o7",         TRU_L2C310_PF_DATA | TRU_L2C310_PF_OFFSET(7U) },
+	{ "d_o15",        TRU_L2C310_PF_DATA | TRU_L2C310_PF_OFFSET(15U) },
+	{ "d_o31",        TRU_L2C310_PF_DATA | TRU_L2C310_PF_OFFSET(31U) },
+	{ "d_o7_dlf",     TRU_L2C310_PF_DATA | TRU_L2C310_PF_DOUBLE_LINEFILL | TRU_L2C310_PF_OFFSET(7U) },
+	{ "d_o7_dlf_inc", TRU_L2C310_PF_DATA | TRU_L2C310_PF_DOUBLE_LINEFILL | TRU_L2C310_PF_INCR_DOUBLE_LINEFILL | TRU_L2C310_PF_OFFSET(7U) },
+	{ "d_o7_drop",    TRU_L2C310_PF_DATA | TRU_L2C310_PF_DROP | TRU_L2C310_PF_OFFSET(7U) },
+	{ "dlf",          TRU_L2C310_PF_DOUBLE_LINEFILL }
+};
+
+static volatile uint32_t pf_sink;
+
+static void pf_stream(void *arg){
+	uint8_t *buf = arg;
+	memcpy(&buf[PF_BUF_SIZE / 2U], buf, PF_BUF_SIZE / 2U);
+}
+
+// Independent reads at random cache lines
+static void pf_random(void *arg){
+	uint32_t *buf = arg;
+	uint32_t seed = 12345U;
+	uint32_t sum = 0U;
+
+	for(uint32_t i = 0U; i < PF_RANDOM_READS; i++){
+		seed = seed * 1664525U + 1013904223U;  // LCG, repeatable
+		sum += buf[(seed >> 8U) % (PF_BUF_SIZE / sizeof(uint32_t))];
+	}
+	pf_sink = sum;
+}
+
+void bench_prefetch_main(void){
+	char name[48];
+	tru_bench_result_t result;
+	uint32_t best_stream = 0U;
+	uint32_t best_random = 0U;
+	uint32_t best_stream_ticks = UINT32_MAX;
+	uint32_t best_random_ticks = UINT32_MAX;
+	uint32_t saved = tru_l2c310_get_prefetch();
+	uint8_t *buf = memalign(32U, PF_BUF_SIZE);
+
+	if(buf == NULL) return;
+	memset(buf, 1, PF_BUF_SIZE);
+
+	for(uint32_t i = 0U; i < sizeof(settings) / sizeof(settings[0]); i++){
+		tru_l2c310_set_prefetch(settings[i].ctrl);
+
+		snprintf(name, sizeof(name), "l2pf_stream_%s", settings[i].name);
+		tru_bench_t stream = { .name = name, .func = pf_stream, .arg = buf, .bytes = PF_BUF_SIZE / 2U };
+		tru_bench_run(&stream, 1U, BENCH_RUNS / 4U, &result);
+		tru_bench_print(&stream, &result);
+		if(result.median < best_stream_ticks){
+			best_stream_ticks = result.median;
+			best_stream = i;
+		}
+
+		snprintf(name, sizeof(name), "l2pf_random_%s_x%u", settings[i].name, PF_RANDOM_READS);
+		tru_bench_t random = { .name = name, .func = pf_random, .arg = buf };
+		tru_bench_run(&random, 1U, BENCH_RUNS / 4U, &result);
+		tru_bench_print(&random, &result);
+		if(result.median < best_random_ticks){
+			best_random_ticks = result.median;
+			best_random = i;
+		}
+	}
+
+	tru_l2c310_set_prefetch(saved);
+	printf("PREFETCH best_stream=%s ctrl=0x%08" PRIx32 " best_random=%s ctrl=0x%08" PRIx32 "\n", settings[best_stream].name, settings[best_stream].ctrl, settings[best_random].name, settings[best_random].ctrl);
+
+	free(buf);
+}
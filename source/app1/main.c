@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251223
+	Version: 20261019
 	Program: Hello, World! AMP for core 0
 	Target : ARM Cortex-A9 on the DE10-Nano Kit development board (Altera
 	         Cyclone V SoC FPGA)
@@ -53,7 +53,19 @@
 // Trulib includes
 #include "tru_config.h"
 #include "tru_iom.h"
+#include "tru_cache.h"
 #include "arm/tru_cortex_a9.h"
+#include "arm/tru_cache_l2c310.h"
+#include "arm/tru_stack.h"
+#include "arm/tru_time.h"
+#include "arm/tru_trace.h"
+#include "arm/tru_boot_prof.h"
+#include "arm/tru_amp_load.h"
+#include "arm/tru_amp_shared.h"
+
+#if defined(TRU_BENCH) && TRU_BENCH == 1U
+	#include "bench/bench.h"
+#endif
 
 // Arm CMSIS includes
 #include "RTE_Components.h"   // CMSIS
@@ -79,11 +91,6 @@ void tx_hello(void){
 	printf("App 1: Hello, World! (AMP, running on core %i)\n", corenum);
 }
 
-void delay_loop(void){
-	volatile uint32_t i = 1000000;
-	while(i--);
-}
-
 // ====================================
 // U-Boot input arguments demonstration
 // ====================================
@@ -122,15 +129,60 @@ int main(int argc, char **argv){
 		initialise_monitor_handles();  // Initialise Semihosting
 	#endif
 
+	tru_time_init(0U);  // Calibrate the time base from the clock manager
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	tru_l2c310_lock_init();  // Clear the L2 maintenance lock in the shared memory, before any L2 maintenance and before app2 starts
+#endif
+#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U)
+	tru_cache_calibrate();  // Measure the size thresholds of the size-adaptive cache functions
+#endif
+#if defined(TRU_TRACE) && TRU_TRACE == 1U
+	tru_trace_start();  // Start logging function entries and exits (fi=1 build option)
+#endif
+
+#if(TRU_BOARD != TRU_BOARD_QEMU_VEXPRESSA9)
+	tru_amp_load_init();  // Clear the load generator commands before app2 starts
+	tru_amp_started_init();  // Clear the startup handshake before app2 starts
+#if defined(TRU_TRACE) && TRU_TRACE == 1U
+	tru_trace_amp_init();  // Clear the trace dump handshake before app2 starts
+#endif
+#if defined(TRU_BOOT_PROF) && TRU_BOOT_PROF == 1U
+	tru_boot_prof_clear(1U);  // Clear the boot log of a previous run before app2 starts
+#endif
 	release_core1();
-	delay_loop();  // Wait for core 1 to finish outputting its messages.  TODO: instead of brute-force wait, implement Inter-process communication (IPC) or interrupts/events
+	tru_amp_wait_started(1U, 1000000U);  // Wait up to 1 s for core 1 to finish outputting its messages
+#endif
 
 #if(TRU_EXIT_TO_UBOOT)
 	tx_cli_args(uboot_argc, uboot_argv);
 #endif
 
 	tx_hello();
+#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U)
+	tru_cache_print_config();  // Warns if a cache or the MMU is off
+#endif
+#if defined(TRU_L2_WAYS) && TRU_L2_WAYS != 0U && defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+	tru_l2c310_init_ways();  // Again after core 1 has started, because its L2 cache setup resets the lockdown of core 0
+#endif
+#if defined(TRU_L2_PIN_FAST) && TRU_L2_PIN_FAST == 1U
+	tru_l2c310_pin_fast();  // After core 1 has started, because its L2 cache setup resets the lockdown
+#endif
+#if defined(TRU_STACK_PAINT) && TRU_STACK_PAINT == 1U
+	tru_stack_print_report();  // Report high-water marks of the processor mode stacks
+#endif
+#if defined(TRU_BOOT_PROF) && TRU_BOOT_PROF == 1U
+	tru_boot_prof_print(0U);  // Time of each startup phase of this core
+	tru_boot_prof_print(1U);  // Time of each startup phase of core 1, stored by app2 in the shared memory
+#endif
+#if defined(TRU_TRACE) && TRU_TRACE == 1U
+	tru_trace_dump_amp(30000000U);  // Then the ring of core 1, up to 30 s at 115200 baud.  Convert with scripts-py/trace_to_json.py
+#endif
+#if defined(TRU_BENCH) && TRU_BENCH == 1U
+	bench_main();  // Compare with a baseline using scripts-py/bench_compare.py
+#endif
+#if(TRU_BOARD != TRU_BOARD_QEMU_VEXPRESSA9)
 	tru_hps_uart_ll_wait_empty((void *)TRU_HPS_UART0_BASE);  // Wait for messages to empty out of UART
+#endif
 
 #if(TRU_EXIT_TO_UBOOT)
 	printf("Exiting application..\n");
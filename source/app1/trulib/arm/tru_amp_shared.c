@@ -0,0 +1,83 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Memory shared between the AMP applications of both cores.
+*/
+
+#include "tru_amp_shared.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_time.h"
+#include <stddef.h>
+
+// The startup assembly code uses these to locate the boot log
+_Static_assert(offsetof(tru_amp_shared_t, boot_log) == 0U, "boot_log must be the first member");
+_Static_assert(sizeof(tru_boot_log_t) == TRU_BOOT_LOG_SIZE, "TRU_BOOT_LOG_SIZE does not match tru_boot_log_t");
+_Static_assert(offsetof(tru_boot_log_t, ts) == TRU_BOOT_LOG_TS_OFFSET, "TRU_BOOT_LOG_TS_OFFSET does not match tru_boot_log_t");
+
+tru_amp_shared_t tru_amp_shared __attribute__((section(".amp_shared")));
+
+// Clears the startup handshake of the other cores, call before releasing them
+void tru_amp_started_init(void){
+	uint32_t mpidr;
+	__read_mpidr(mpidr);
+
+	for(uint32_t i = 0U; i < TRU_AMP_CPU_MAX; i++){
+		if(i != (mpidr & 0x3U)) tru_amp_shared.started[i] = 0U;
+	}
+	__dmb();
+}
+
+// Tells the controlling core that the calling core has finished its startup messages
+void tru_amp_set_started(void){
+	uint32_t mpidr;
+	__read_mpidr(mpidr);
+
+	tru_amp_shared.started[mpidr & 0x3U] = 1U;
+	__dsb();  // Ensure the write is visible before the event
+	__sev();
+}
+
+// Waits up to timeout_us for the core to call tru_amp_set_started().  Returns -1 on timeout, e.g. when the core has no program
+int32_t tru_amp_wait_started(uint32_t cpu, uint32_t timeout_us){
+	uint64_t end = tru_time_us() + timeout_us;
+
+	while(tru_amp_shared.started[cpu] == 0U){
+		if(tru_time_us() >= end) return -1;
+	}
+
+	return 0;
+}
+
+// Clears the lock, call before the other core can use it
+void tru_amp_lock_init(tru_amp_lock_t *lock){
+	lock->want[0] = 0U;
+	lock->want[1] = 0U;
+	lock->turn = 0U;
+	__dmb();
+}
+
+#endif
@@ -0,0 +1,253 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm CoreLink™ Level 2 Cache Controller L2C-310 support.
+*/
+
+#include "tru_cache_l2c310.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include "tru_iom.h"
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#define L2C310_REG(offset) ((uint32_t *)(TRU_L2C310_BASE + (offset)))
+
+uint32_t tru_l2c310_pinned_ways;  // Ways locked for all masters by tru_l2c310_pin_range()
+
+// ==================
+// Lockdown by master
+// ==================
+
+uint32_t tru_l2c310_get_num_ways(void){
+	return (iom_rd32(L2C310_REG(TRU_L2C310_AUX_CTRL_OFFSET)) & TRU_L2C310_AUX_ASSOC_16WAY) ? 16U : 8U;
+}
+
+// Sets the ways locked for a master (a set bit = the master cannot allocate into the way)
+void tru_l2c310_set_lockdown(uint32_t master, uint32_t d_ways, uint32_t i_ways){
+	if(master >= TRU_L2C310_MASTER_MAX) return;
+
+	iom_wr32(L2C310_REG(TRU_L2C310_D_LOCKDN0_OFFSET + master * TRU_L2C310_LOCKDN_STRIDE), d_ways);
+	iom_wr32(L2C310_REG(TRU_L2C310_I_LOCKDN0_OFFSET + master * TRU_L2C310_LOCKDN_STRIDE), i_ways);
+	__dsb();  // Ensure the lockdown applies to the following accesses
+}
+
+void tru_l2c310_get_lockdown(uint32_t master, uint32_t *d_ways, uint32_t *i_ways){
+	if(master >= TRU_L2C310_MASTER_MAX){
+		*d_ways = 0U;
+		*i_ways = 0U;
+		return;
+	}
+
+	*d_ways = iom_rd32(L2C310_REG(TRU_L2C310_D_LOCKDN0_OFFSET + master * TRU_L2C310_LOCKDN_STRIDE));
+	*i_ways = iom_rd32(L2C310_REG(TRU_L2C310_I_LOCKDN0_OFFSET + master * TRU_L2C310_LOCKDN_STRIDE));
+}
+
+// Allows a master to allocate data and instructions into the given ways only.  The pinned ways stay locked
+void tru_l2c310_set_ways(uint32_t master, uint32_t ways){
+	uint32_t all = (1U << tru_l2c310_get_num_ways()) - 1U;
+	uint32_t locked = (~ways & all) | tru_l2c310_pinned_ways;
+
+	tru_l2c310_set_lockdown(master, locked, locked);
+}
+
+// Sets up the ways of the calling core from the user configuration
+void tru_l2c310_init_ways(void){
+#if defined(TRU_L2_WAYS) && TRU_L2_WAYS != 0U
+	uint32_t mpidr;
+	__read_mpidr(mpidr);
+
+	tru_l2c310_set_ways(mpidr & 0x3U, TRU_L2_WAYS);
+#endif
+}
+
+// ========
+// Prefetch
+// ========
+
+uint32_t tru_l2c310_get_prefetch(void){
+	return iom_rd32(L2C310_REG(TRU_L2C310_PREFETCH_CTRL_OFFSET));
+}
+
+// Sets the prefetch control register, e.g. to one of the TRU_L2C310_PF_PRESET_x
+void tru_l2c310_set_prefetch(uint32_t ctrl){
+	iom_wr32(L2C310_REG(TRU_L2C310_PREFETCH_CTRL_OFFSET), ctrl);
+	__dsb();
+}
+
+// Sets the prefetch from the user configuration
+void tru_l2c310_init_prefetch(void){
+#if defined(TRU_L2_PREFETCH) && TRU_L2_PREFETCH != 0U
+	tru_l2c310_set_prefetch(TRU_L2_PREFETCH);
+#endif
+}
+
+// ==============
+// Event counters
+// ==============
+
+// Resets the counters and starts counting the given events
+void tru_l2c310_ev_start(tru_l2c310_event_t ev0, tru_l2c310_event_t ev1){
+	iom_wr32(L2C310_REG(TRU_L2C310_EV_CTRL_OFFSET), 0U);  // The sources can only be changed while disabled
+	iom_wr32(L2C310_REG(TRU_L2C310_EV_CNT0_CFG_OFFSET), (uint32_t)ev0 << TRU_L2C310_EV_CFG_SRC_POS);  // No interrupt
+	iom_wr32(L2C310_REG(TRU_L2C310_EV_CNT1_CFG_OFFSET), (uint32_t)ev1 << TRU_L2C310_EV_CFG_SRC_POS);
+	iom_wr32(L2C310_REG(TRU_L2C310_EV_CTRL_OFFSET), TRU_L2C310_EV_CTRL_RESET0 | TRU_L2C310_EV_CTRL_RESET1);
+	iom_wr32(L2C310_REG(TRU_L2C310_EV_CTRL_OFFSET), TRU_L2C310_EV_CTRL_ENABLE);
+}
+
+// Stops counting, the counts are kept
+void tru_l2c310_ev_stop(void){
+	iom_wr32(L2C310_REG(TRU_L2C310_EV_CTRL_OFFSET), 0U);
+}
+
+// The counters saturate at 0xffffffff
+void tru_l2c310_ev_read(uint32_t *cnt0, uint32_t *cnt1){
+	*cnt0 = iom_rd32(L2C310_REG(TRU_L2C310_EV_CNT0_OFFSET));
+	*cnt1 = iom_rd32(L2C310_REG(TRU_L2C310_EV_CNT1_OFFSET));
+}
+
+// =======
+// Pinning
+// =======
+
+uint32_t tru_l2c310_get_way_size(void){
+	uint32_t way_size = (iom_rd32(L2C310_REG(TRU_L2C310_AUX_CTRL_OFFSET)) >> 17U) & 0x7U;  // 1 = 16KB .. 6 = 512KB
+
+	return 8192U << way_size;
+}
+
+// Cleans and invalidates the lines of a range from the L1 cache of this core
+static void pin_l1_cleaninv(uint32_t start, uint32_t end){
+	for(uint32_t addr = start; addr < end; addr += TRU_L2C310_CACHELINE_SIZE) __set_DCCIMVAC(addr);
+	__DSB();
+}
+
+// Pins a range into free ways, returns the ways in ways.  Returns -1 if there are not enough free ways
+int32_t tru_l2c310_pin_range(void *buf, uint32_t size, uint32_t *ways){
+	uint32_t num_ways = tru_l2c310_get_num_ways();
+	uint32_t way_size = tru_l2c310_get_way_size();
+	uint32_t all = (1U << num_ways) - 1U;
+	uint32_t free_ways = all & ~tru_l2c310_pinned_ways;
+	uint32_t start = (uint32_t)buf & ~(TRU_L2C310_CACHELINE_SIZE - 1U);
+	uint32_t end = (uint32_t)buf + size;
+	uint32_t needed = (end - start + way_size - 1U) / way_size;
+	uint32_t pin_ways = 0U;
+	uint32_t way_list[16];
+	uint32_t d_ways[TRU_L2C310_MASTER_MAX];
+	uint32_t i_ways[TRU_L2C310_MASTER_MAX];
+	uint32_t mpidr;
+
+	*ways = 0U;
+	if(size == 0U) return 0;
+
+	// Choose the ways, from the highest free way downwards
+	for(uint32_t way = num_ways, n = 0U; way > 0U && n < needed; way--){
+		if(free_ways & (1U << (way - 1U))){
+			way_list[n++] = way - 1U;
+			pin_ways |= 1U << (way - 1U);
+		}
+	}
+	if(__builtin_popcount(pin_ways) != (int)needed || (free_ways & ~pin_ways) == 0U) return -1;
+
+	__read_mpidr(mpidr);
+	uint32_t master = mpidr & 0x3U;
+	uint32_t cpsr = tru_l2c310_lock();  // No other L2 maintenance while the lines are loaded
+
+	// Lock the chosen ways for the other masters first, so they cannot allocate into them while loading
+	for(uint32_t m = 0U; m < TRU_L2C310_MASTER_MAX; m++){
+		tru_l2c310_get_lockdown(m, &d_ways[m], &i_ways[m]);
+		if(m != master) tru_l2c310_set_lockdown(m, d_ways[m] | pin_ways, i_ways[m] | pin_ways);
+	}
+
+	// Remove the range from both caches, so that every line misses and allocates into the chosen way
+	pin_l1_cleaninv(start, end);
+	for(uint32_t addr = start; addr < end; addr += TRU_L2C310_CACHELINE_SIZE) iom_wr32(L2C310_REG(TRU_L2C310_CLEANINV_PA_OFFSET), addr);
+	iom_wr32(L2C310_REG(TRU_L2C310_CACHE_SYNC_OFFSET), 0U);
+	__DSB();
+
+	// Load one way size of the range into each way, with only that way unlocked for this core
+	uint32_t addr = start;
+	for(uint32_t n = 0U; n < needed; n++){
+		uint32_t limit = (end - addr > way_size) ? addr + way_size : end;
+		uint32_t unlocked = 1U << way_list[n];
+
+		tru_l2c310_set_lockdown(master, all & ~unlocked, all & ~unlocked);
+		for(; addr < limit; addr += TRU_L2C310_CACHELINE_SIZE) (void)*(volatile uint32_t *)addr;
+		__DSB();
+	}
+
+	tru_l2c310_set_lockdown(master, d_ways[master] | pin_ways, i_ways[master] | pin_ways);
+	tru_l2c310_pinned_ways |= pin_ways;
+	tru_l2c310_unlock(cpsr);
+
+	*ways = pin_ways;
+	return 0;
+}
+
+// Returns the percentage of the lines of a range that hit in the L2 cache
+uint32_t tru_l2c310_verify_range(void *buf, uint32_t size){
+	uint32_t start = (uint32_t)buf & ~(TRU_L2C310_CACHELINE_SIZE - 1U);
+	uint32_t end = (uint32_t)buf + size;
+	uint32_t reqs;
+	uint32_t hits;
+
+	if(size == 0U) return 100U;
+
+	uint32_t cpsr = tru_irq_save();
+	pin_l1_cleaninv(start, end);  // Every read must go to the L2 cache
+	tru_l2c310_ev_start(TRU_L2C310_EV_DRREQ, TRU_L2C310_EV_DRHIT);
+	for(uint32_t addr = start; addr < end; addr += TRU_L2C310_CACHELINE_SIZE) (void)*(volatile uint32_t *)addr;
+	__DSB();
+	tru_l2c310_ev_stop();
+	tru_l2c310_ev_read(&reqs, &hits);
+	tru_irq_restore(cpsr);
+
+	return reqs ? (uint32_t)((uint64_t)hits * 100U / reqs) : 0U;
+}
+
+#if defined(TRU_L2_PIN_FAST) && TRU_L2_PIN_FAST == 1U
+extern uint32_t __fast_start;  // Reference external symbol name from the linker file
+extern uint32_t __fast_end;    // Reference external symbol name from the linker file
+
+// Pins the .fast section and prints the result
+void tru_l2c310_pin_fast(void){
+	uint32_t size = (uint32_t)&__fast_end - (uint32_t)&__fast_start;
+	uint32_t ways;
+
+	if(tru_l2c310_pin_range(&__fast_start, size, &ways) != 0){
+		printf("L2PIN .fast size=%" PRIu32 " failed, not enough free ways (way size %" PRIu32 ")\n", size, tru_l2c310_get_way_size());
+		return;
+	}
+	printf("L2PIN .fast size=%" PRIu32 " ways=0x%02" PRIx32 " hit_pct=%" PRIu32 "\n", size, ways, tru_l2c310_verify_range(&__fast_start, size));
+}
+#endif
+
+#endif
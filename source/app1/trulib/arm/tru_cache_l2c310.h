@@ -21,9 +21,77 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251206
+	Version: 20261019
 
-	Arm CoreLink™ Level 2 Cache Controller L2C-310 registers.
+	Arm CoreLink™ Level 2 Cache Controller L2C-310 registers and support.
+
+	Lockdown by master
+	==================
+
+	The L2C-310 has a pair of lockdown registers (data and instruction) for
+	each of up to 8 masters, where the master number is the Cortex-A9 CPU
+	number.  A set bit locks the way for the master: the master cannot
+	allocate (fetch) lines into it, but it still hits on lines already in it.
+	Giving each core a different set of ways partitions the shared L2 cache,
+	so a core cannot evict the working set of the other core.
+
+	Each app sets up its own core from tru_user_config.h with TRU_CFG_L2_WAYS,
+	the bit mask of the ways the core can allocate into (0 = no change).
+	The ways of the cores should not overlap.
+	SystemInit() applies them, but when app2 enables the L2 cache its
+	L2C_Enable() clears the data lockdown of master 0, i.e. the
+	partition of core 0 that app1 has already set up.  So app1 applies its
+	ways again from main() after core 1 has started, together with
+	tru_l2c310_pin_fast().
+
+	Prefetch
+	========
+
+	The prefetch control register can be changed at any time.  The presets
+	are starting points, run bench/bench_prefetch.c (bench=1) to find the
+	best setting for a workload.  Set TRU_CFG_L2_PREFETCH to one of them (or
+	any register value) to apply it at startup, 0 = no change.
+	Early BRESP is in the auxiliary control register, which can only be
+	written while the L2 cache is disabled, so it is a startup setting only
+	(TRU_CFG_L2_EARLY_BRESP).
+
+	Event counters
+	==============
+
+	The two event counters count an event source each, e.g. the data read
+	requests and hits for the L2 hit ratio.  They count the events of all
+	masters, i.e. of both cores and the ACP.  The benchmarks report the L2
+	data read hit ratio with TRU_CFG_BENCH_L2_EVENTS = 1U.
+
+	Pinning (lockdown by way)
+	=========================
+
+	A range is pinned by loading it into ways that no master can allocate
+	into afterwards, so its lines are never evicted (by either core) and an
+	ISR or control loop never takes the first miss to SDRAM after
+	interference.  Each way holds one way size (64KB on the Cyclone V) of a
+	contiguous range.  A range is pinned into its own ways, taken from the
+	highest free way downwards, and at least one way is always left free.
+	The lines are loaded with LDR, because PLD and PLI are hints that can be
+	dropped, and the L2 cache is unified so this also loads code.
+	The Cortex-A9 L1 caches have no lockdown, so only the L2 cache can pin.
+
+	Code and data marked TRU_FASTCODE and TRU_FASTDATA are placed together
+	in the .fast section by the linker file.  With TRU_CFG_L2_PIN_FAST = 1U,
+	app1 pins it with tru_l2c310_pin_fast() after core 1 has started (the L2
+	cache setup of app2 resets the lockdown of master 0).  The pinned lines
+	are verified by reading them with the L1 cache cleaned and invalidated,
+	and counting the L2 hits.
+
+	Maintenance lock
+	================
+
+	The L2 cache is shared by both cores, and no other maintenance operation
+	may be issued while a background (by-way) operation is in progress.
+	The trulib L2 maintenance functions (tru_cache.h and the pinning) hold
+	tru_l2c310_lock(), a lock in the shared memory taken with IRQs masked.
+	app1 initialises it with tru_l2c310_lock_init() before any L2
+	maintenance and before releasing core 1.
 */
 
 #ifndef TRU_CAHCE_L2C310_H
@@ -33,20 +101,115 @@
 
 #if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
 
+#include "tru_amp_shared.h"
+
 #define TRU_L2C310_CTRL_OFFSET          0x100U
 #define TRU_L2C310_AUX_CTRL_OFFSET      0x104U
 #define TRU_L2C310_TAGRAM_OFFSET        0x108U
 #define TRU_L2C310_DATARAM_OFFSET       0x10cU
+#define TRU_L2C310_EV_CTRL_OFFSET       0x200U
+#define TRU_L2C310_EV_CNT1_CFG_OFFSET   0x204U
+#define TRU_L2C310_EV_CNT0_CFG_OFFSET   0x208U
+#define TRU_L2C310_EV_CNT1_OFFSET       0x20cU
+#define TRU_L2C310_EV_CNT0_OFFSET       0x210U
 #define TRU_L2C310_INT_CLR_OFFSET       0x220U
 #define TRU_L2C310_CACHE_SYNC_OFFSET    0x730U
 #define TRU_L2C310_INV_PA_OFFSET        0x770U
 #define TRU_L2C310_CLEAN_PA_OFFSET      0x7b0U
 #define TRU_L2C310_CLEANINV_PA_OFFSET   0x7f0U
 #define TRU_L2C310_D_LOCKDN0_OFFSET     0x900U
+#define TRU_L2C310_I_LOCKDN0_OFFSET     0x904U
+#define TRU_L2C310_LOCKDN_STRIDE        8U     // Offset between the lockdown registers of the masters
 #define TRU_L2C310_DBG_CTRL_OFFSET      0xf40U
 #define TRU_L2C310_PREFETCH_CTRL_OFFSET 0xf60U
 
 #define TRU_L2C310_CACHELINE_SIZE 32U
+#define TRU_L2C310_MASTER_MAX     8U
+
+#define TRU_L2C310_AUX_ASSOC_16WAY (1U << 16U)
+#define TRU_L2C310_AUX_EARLY_BRESP (1U << 30U)
+
+// Prefetch control register bits
+#define TRU_L2C310_PF_DOUBLE_LINEFILL      (1U << 30U)  // Fetch 64 bytes (two lines) on a line fill
+#define TRU_L2C310_PF_INSTR                (1U << 29U)  // Instruction prefetch enable
+#define TRU_L2C310_PF_DATA                 (1U << 28U)  // Data prefetch enable
+#define TRU_L2C310_PF_DOUBLE_LINEFILL_WRAP (1U << 27U)  // Double linefill on WRAP read disable
+#define TRU_L2C310_PF_DROP                 (1U << 24U)  // Drop prefetches that hit a busy slave
+#define TRU_L2C310_PF_INCR_DOUBLE_LINEFILL (1U << 23U)  // Double linefill on INCR reads
+#define TRU_L2C310_PF_NOT_SAME_ID          (1U << 21U)  // Not same ID on exclusive sequence enable
+#define TRU_L2C310_PF_OFFSET(n)            ((n) & 0x1fU)  // Lines ahead to prefetch, 0 - 7, 15, 23 or 31
+
+// Prefetch presets
+#define TRU_L2C310_PF_PRESET_OFF      0U
+#define TRU_L2C310_PF_PRESET_RANDOM   TRU_L2C310_PF_INSTR  // No data prefetch, it wastes SDRAM bandwidth on random accesses
+#define TRU_L2C310_PF_PRESET_BALANCED (TRU_L2C310_PF_INSTR | TRU_L2C310_PF_DATA | TRU_L2C310_PF_DROP | TRU_L2C310_PF_OFFSET(3U))
+#define TRU_L2C310_PF_PRESET_STREAM   (TRU_L2C310_PF_INSTR | TRU_L2C310_PF_DATA | TRU_L2C310_PF_DOUBLE_LINEFILL | TRU_L2C310_PF_INCR_DOUBLE_LINEFILL | TRU_L2C310_PF_OFFSET(7U))
+
+// Event counter control register bits
+#define TRU_L2C310_EV_CTRL_ENABLE (1U << 0U)
+#define TRU_L2C310_EV_CTRL_RESET0 (1U << 1U)
+#define TRU_L2C310_EV_CTRL_RESET1 (1U << 2U)
+
+// Event counter configuration register, bits [5:2]
+#define TRU_L2C310_EV_CFG_SRC_POS 2U
+
+#include <stdint.h>
+
+// Places a function or variable in the .fast section, see tru_l2c310_pin_fast()
+#define TRU_FASTCODE __attribute__((section(".fastcode")))
+#define TRU_FASTDATA __attribute__((section(".fastdata")))
+
+// Event counter sources
+typedef enum{
+	TRU_L2C310_EV_DISABLED = 0,
+	TRU_L2C310_EV_CO,        // Eviction (castout) of a line
+	TRU_L2C310_EV_DRHIT,     // Data read hit
+	TRU_L2C310_EV_DRREQ,     // Data read request
+	TRU_L2C310_EV_DWHIT,     // Data write hit
+	TRU_L2C310_EV_DWREQ,     // Data write request
+	TRU_L2C310_EV_DWTREQ,    // Data write request with write-through attribute
+	TRU_L2C310_EV_IRHIT,     // Instruction read hit
+	TRU_L2C310_EV_IRREQ,     // Instruction read request
+	TRU_L2C310_EV_WA,        // Write allocate
+	TRU_L2C310_EV_IPFALLOC,  // Prefetch allocation by the internal prefetcher
+	TRU_L2C310_EV_EPFHIT,    // Prefetch hint hit
+	TRU_L2C310_EV_EPFALLOC,  // Prefetch hint allocation
+	TRU_L2C310_EV_SRRCVD,    // Speculative read received
+	TRU_L2C310_EV_SRCONF,    // Speculative read confirmed
+	TRU_L2C310_EV_EPFRCVD    // Prefetch hint received
+}tru_l2c310_event_t;
+
+uint32_t tru_l2c310_get_num_ways(void);
+void tru_l2c310_set_lockdown(uint32_t master, uint32_t d_ways, uint32_t i_ways);
+void tru_l2c310_get_lockdown(uint32_t master, uint32_t *d_ways, uint32_t *i_ways);
+void tru_l2c310_set_ways(uint32_t master, uint32_t ways);
+void tru_l2c310_init_ways(void);
+uint32_t tru_l2c310_get_prefetch(void);
+void tru_l2c310_set_prefetch(uint32_t ctrl);
+void tru_l2c310_init_prefetch(void);
+void tru_l2c310_ev_start(tru_l2c310_event_t ev0, tru_l2c310_event_t ev1);
+void tru_l2c310_ev_stop(void);
+void tru_l2c310_ev_read(uint32_t *cnt0, uint32_t *cnt1);
+
+extern uint32_t tru_l2c310_pinned_ways;
+
+uint32_t tru_l2c310_get_way_size(void);
+int32_t tru_l2c310_pin_range(void *buf, uint32_t size, uint32_t *ways);
+uint32_t tru_l2c310_verify_range(void *buf, uint32_t size);
+void tru_l2c310_pin_fast(void);
+
+static inline void tru_l2c310_lock_init(void){
+	tru_amp_lock_init(&tru_amp_shared.l2_lock);
+}
+
+// Serialises the L2 maintenance of both cores, IRQs are masked until tru_l2c310_unlock()
+static inline uint32_t tru_l2c310_lock(void){
+	return tru_amp_lock(&tru_amp_shared.l2_lock);
+}
+
+static inline void tru_l2c310_unlock(uint32_t cpsr){
+	tru_amp_unlock(&tru_amp_shared.l2_lock, cpsr);
+}
 
 #endif
 
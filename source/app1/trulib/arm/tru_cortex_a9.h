@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251223
+	Version: 20261019
 
 	Arm Cortex-A9 low level assembly & MPCore registers.
 */
@@ -38,6 +38,11 @@
 #define TRU_GLOBAL_TIMER_BASE  (TRU_PERIPH_BASE + 0x200U)
 #define TRU_PRIVATE_TIMER_BASE (TRU_PERIPH_BASE + 0x600U)
 
+// Private peripheral interrupt (PPI) IDs, these are banked per processor
+#define GTIM_IRQ_ID    27U  // Global timer
+#define PTIM_IRQ_ID    29U  // Private timer
+#define PTIM_WD_IRQ_ID 30U  // Private watchdog
+
 //===========================
 // GCC inline assembly macros
 //===========================
@@ -45,6 +50,7 @@
 // Synchronise related
 #define __wfe() __asm__ volatile("wfe":::"memory")
 #define __sev() __asm__ volatile("sev")
+#define __wfi() __asm__ volatile("wfi":::"memory")
 #define __dmb() __asm__ volatile("dmb 0xF":::"memory");
 #define __dsb() __asm__ volatile("dsb 0xF":::"memory");
 #define __isb() __asm__ volatile("isb 0xF":::"memory");
@@ -61,9 +67,31 @@
 #define __read_clidr(result)  __asm__ volatile("MRC p15, 1, %0, c0, c0, 1" : "=r"(result) : : "memory")
 #define __read_mpidr(mpidr)   __asm__ volatile("MRC p15, 0, %0, c0, c0, 5" : "=r"(mpidr) : : "memory")
 
+// Interrupt mask related
+#define __cpsid_i() __asm__ volatile("cpsid i":::"memory")
+#define __cpsie_i() __asm__ volatile("cpsie i":::"memory")
+#define __read_cpsr(result) __asm__ volatile("MRS %0, cpsr" : "=r"(result) : : "memory")
+
 // MMU related
 #define __write_tlbimvaa(va)  __asm__ volatile("MRC p15, 0, %0, c8, c7, 3" : : "r"(va) : "memory")
 
+// ==============
+// Interrupt mask
+// ==============
+
+// Masks IRQs and returns the previous CPSR value for tru_irq_restore()
+static inline uint32_t tru_irq_save(void){
+	uint32_t cpsr;
+	__read_cpsr(cpsr);
+	__cpsid_i();
+	return cpsr;
+}
+
+// Unmasks IRQs only if they were unmasked before tru_irq_save()
+static inline void tru_irq_restore(uint32_t cpsr){
+	if((cpsr & (0x1U << 7U)) == 0U) __cpsie_i();  // CPSR I bit 7
+}
+
 // ============
 // Global timer
 // ============
@@ -159,6 +187,11 @@ static inline uint64_t gtim_get_counter(void){
 	return (uint64_t)upper << 32U | lower;
 }
 
+// Reads only the lower 32 bits, which is enough for measuring short intervals (wraps after 2^32 ticks)
+static inline uint32_t gtim_get_counter_low(void){
+	return GTIM_REG->counterl;
+}
+
 static inline void gtim_set_counter(uint64_t counter){
 	GTIM_REG->counterl = (uint32_t)counter;
 	GTIM_REG->counterh = (uint32_t)(counter >> 32U);
@@ -169,6 +202,28 @@ static inline void gtim_clear_event(void){
 	GTIM_REG->intrstatus.bits.eventflag = 1;
 }
 
+// Is the timer running?
+static inline uint32_t gtim_is_enabled(void){
+	return GTIM_REG->control.bits.enable;
+}
+
+// Set the comparator value.  Note, the comparator and its interrupt are banked per processor
+static inline void gtim_set_compare(uint64_t compare){
+	GTIM_REG->control.val &= ~GTIM_CONTROL_COMPARE_ENABLE_MSK;  // Disable compare while the two halves are written
+	GTIM_REG->comparel = (uint32_t)compare;
+	GTIM_REG->compareh = (uint32_t)(compare >> 32U);
+}
+
+// Enable compare with interrupt
+static inline void gtim_compare_irq_enable(void){
+	GTIM_REG->control.val |= (GTIM_CONTROL_COMPARE_ENABLE_MSK | GTIM_CONTROL_IRQ_ENABLE_MSK);
+}
+
+// Disable compare and its interrupt
+static inline void gtim_compare_irq_disable(void){
+	GTIM_REG->control.val &= ~(GTIM_CONTROL_COMPARE_ENABLE_MSK | GTIM_CONTROL_IRQ_ENABLE_MSK);
+}
+
 // ========================
 // Private timer & watchdog
 // ========================
@@ -0,0 +1,149 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Interrupt statistics and latency measurement for Arm Cortex-A9.
+*/
+
+#include "tru_irq_stats.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <stdio.h>
+#include <inttypes.h>
+
+tru_irq_stats_t tru_irq_stats[IRQ_GIC_LINE_COUNT];
+volatile uint32_t tru_irq_entry_ts;
+
+// Written by the latency test handler
+static volatile uint32_t lat_entry_ts;
+static volatile uint32_t lat_handler_ts;
+static volatile uint32_t lat_fired;
+
+// Copies with IRQs masked, so the fields are consistent
+void tru_irq_stats_get(uint32_t irq_id, tru_irq_stats_t *stats){
+	uint32_t cpsr = tru_irq_save();
+	*stats = tru_irq_stats[irq_id];
+	tru_irq_restore(cpsr);
+}
+
+void tru_irq_stats_clear(void){
+	uint32_t cpsr = tru_irq_save();
+	for(uint32_t i = 0U; i < IRQ_GIC_LINE_COUNT; i++){
+		tru_irq_stats[i].count = 0U;
+		tru_irq_stats[i].max = 0U;
+		tru_irq_stats[i].total = 0U;
+	}
+	tru_irq_restore(cpsr);
+}
+
+void tru_irq_stats_print(void){
+	tru_irq_stats_t stats;
+
+	for(uint32_t i = 0U; i < IRQ_GIC_LINE_COUNT; i++){
+		tru_irq_stats_get(i, &stats);
+		if(stats.count){
+			printf("IRQSTAT %" PRIu32 " count=%" PRIu32 " total=%" PRIu64 " max=%" PRIu32 "\n", i, stats.count, stats.total, stats.max);
+		}
+	}
+}
+
+// ==========================
+// Entry latency measurement
+// ==========================
+
+static void gtim_lat_handler(void){
+	lat_handler_ts = gtim_get_counter_low();
+	lat_entry_ts = tru_irq_entry_ts;
+	gtim_compare_irq_disable();
+	gtim_clear_event();
+	lat_fired = 1U;
+}
+
+static void sgi_lat_handler(void){
+	lat_handler_ts = gtim_get_counter_low();
+	lat_entry_ts = tru_irq_entry_ts;
+	lat_fired = 1U;
+}
+
+// Measures the latency while the processor is running (busy-polling), see tru_idle_measure_latency() for the wakeup from WFI.
+// Must be called with IRQs enabled.  Returns -1 if the source is unknown
+int32_t tru_irq_measure_latency(tru_irq_latency_src_t src, uint32_t samples, tru_irq_latency_stats_t *stats){
+	uint32_t irq_id;
+	IRQHandler_t handler;
+
+	switch(src){
+		case TRU_IRQ_LATENCY_GTIM:
+			irq_id = GTIM_IRQ_ID;
+			handler = gtim_lat_handler;
+			break;
+		case TRU_IRQ_LATENCY_SGI:
+			irq_id = TRU_IRQ_LATENCY_SGI_ID;
+			handler = sgi_lat_handler;
+			break;
+		default:
+			return -1;
+	}
+
+	IRQHandler_t prev_handler = IRQ_GetHandler(irq_id);
+
+	tru_idle_latency_init(&stats->entry);
+	tru_idle_latency_init(&stats->handler);
+
+	if(!gtim_is_enabled()) gtim_enable();
+	IRQ_SetHandler(irq_id, handler);
+	IRQ_Enable(irq_id);
+
+	for(uint32_t i = 0U; i < samples; i++){
+		uint32_t event_ts;
+
+		lat_fired = 0U;
+		if(src == TRU_IRQ_LATENCY_GTIM){
+			event_ts = (uint32_t)tru_idle_gtim_arm(1000U);  // The same busy-polled event as the "hot" wakeup latency of tru_idle_measure_latency()
+		}else{
+			event_ts = gtim_get_counter_low();
+			GIC_SendSGI((IRQn_Type)irq_id, 0U, 2U);  // Filter 2 = send only to this processor
+		}
+		while(lat_fired == 0U);
+
+		tru_idle_latency_add(&stats->entry, lat_entry_ts - event_ts);
+		tru_idle_latency_add(&stats->handler, lat_handler_ts - event_ts);
+	}
+
+	IRQ_Disable(irq_id);
+	IRQ_SetHandler(irq_id, prev_handler);
+
+	return 0;
+}
+
+void tru_irq_print_latency(const tru_irq_latency_stats_t *stats){
+	printf("Interrupt latency (global timer ticks):\n");
+	tru_idle_latency_print("IRQ_Handler", &stats->entry);
+	tru_idle_latency_print("Handler", &stats->handler);
+}
+
+#endif
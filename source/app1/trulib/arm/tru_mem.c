@@ -0,0 +1,294 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 memcpy, memmove and memset with NEON and PLD.
+*/
+
+#include "tru_mem.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_MEM_OVERRIDE) && TRU_MEM_OVERRIDE == 1U && !(defined(TRU_NEON) && TRU_NEON == 1U)
+	#error "TRU_CFG_MEM_OVERRIDE = 1U requires TRU_CFG_NEON = 1U, otherwise every memcpy and memset takes an undefined instruction exception"
+#endif
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_NEON) && TRU_NEON == 1U
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+// Stops GCC from turning the byte loops back into memcpy and memset calls, which would recurse with TRU_MEM_OVERRIDE
+#pragma GCC optimize("no-tree-loop-distribute-patterns")
+
+#define NT_ALIGN 32U  // Destination alignment of tru_memcpy_nt(), one cache line and one AXI burst
+
+typedef uint32_t __attribute__((may_alias)) word_t;
+
+uint32_t tru_mem_pld_dist = TRU_MEM_PLD_DIST;
+
+// ===========
+// Small parts
+// ===========
+
+static inline void copy_small(uint8_t *d, const uint8_t *s, size_t n){
+	if((((uint32_t)d | (uint32_t)s) & 3U) == 0U){
+		for(; n >= 4U; n -= 4U, d += 4U, s += 4U) *(word_t *)d = *(const word_t *)s;
+	}
+	while(n--) *d++ = *s++;
+}
+
+// Copies from the end downwards, for an overlapping memmove with the destination above the source
+static inline void copy_small_back(uint8_t *d, const uint8_t *s, size_t n){
+	if((((uint32_t)d | (uint32_t)s) & 3U) == 0U){
+		for(; n >= 4U; n -= 4U){
+			d -= 4U;
+			s -= 4U;
+			*(word_t *)d = *(const word_t *)s;
+		}
+	}
+	while(n--) *--d = *--s;
+}
+
+static inline void set_small(uint8_t *d, uint8_t c, size_t n){
+	if(((uint32_t)d & 3U) == 0U){
+		uint32_t w = c * 0x01010101U;
+		for(; n >= 4U; n -= 4U, d += 4U) *(word_t *)d = w;
+	}
+	while(n--) *d++ = c;
+}
+
+// ===========
+// Block parts
+// ===========
+
+// Copies 64 byte blocks (at least one), the destination and the source must be word aligned
+static inline void copy_blocks_vldm(uint8_t *d, const uint8_t *s, size_t blocks, uint32_t pld){
+	__asm__ volatile(
+		"1:\n\t"
+		"pld [%1, %3]\n\t"
+		"pld [%1, %4]\n\t"
+		"vldmia %1!, {d0-d7}\n\t"
+		"vstmia %0!, {d0-d7}\n\t"
+		"subs %2, %2, #1\n\t"
+		"bne 1b\n\t"
+		: "+r"(d), "+r"(s), "+r"(blocks)
+		: "r"(pld), "r"(pld + 32U)
+		: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory"
+	);
+}
+
+// Copies 64 byte blocks, the destination must be word aligned, the source can have any alignment
+static inline void copy_blocks_vld1(uint8_t *d, const uint8_t *s, size_t blocks, uint32_t pld){
+	__asm__ volatile(
+		"1:\n\t"
+		"pld [%1, %3]\n\t"
+		"pld [%1, %4]\n\t"
+		"vld1.8 {d0-d3}, [%1]!\n\t"
+		"vld1.8 {d4-d7}, [%1]!\n\t"
+		"vstmia %0!, {d0-d7}\n\t"
+		"subs %2, %2, #1\n\t"
+		"bne 1b\n\t"
+		: "+r"(d), "+r"(s), "+r"(blocks)
+		: "r"(pld), "r"(pld + 32U)
+		: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory"
+	);
+}
+
+// Copies 64 byte blocks downwards from the end pointers, the destination and the source must be word aligned
+static inline void copy_blocks_back_vldm(uint8_t *d, const uint8_t *s, size_t blocks, uint32_t pld){
+	__asm__ volatile(
+		"1:\n\t"
+		"pld [%1, -%3]\n\t"
+		"pld [%1, -%4]\n\t"
+		"vldmdb %1!, {d0-d7}\n\t"
+		"vstmdb %0!, {d0-d7}\n\t"
+		"subs %2, %2, #1\n\t"
+		"bne 1b\n\t"
+		: "+r"(d), "+r"(s), "+r"(blocks)
+		: "r"(pld + 32U), "r"(pld + 64U)
+		: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory"
+	);
+}
+
+// Copies 64 byte blocks with 32 byte aligned stores, the destination must be 32 byte aligned
+static inline void copy_blocks_nt(uint8_t *d, const uint8_t *s, size_t blocks, uint32_t pld){
+	__asm__ volatile(
+		"1:\n\t"
+		"pld [%1, %3]\n\t"
+		"pld [%1, %4]\n\t"
+		"vld1.8 {d0-d3}, [%1]!\n\t"
+		"vld1.8 {d4-d7}, [%1]!\n\t"
+		"vst1.64 {d0-d3}, [%0, :256]!\n\t"
+		"vst1.64 {d4-d7}, [%0, :256]!\n\t"
+		"subs %2, %2, #1\n\t"
+		"bne 1b\n\t"
+		: "+r"(d), "+r"(s), "+r"(blocks)
+		: "r"(pld), "r"(pld + 32U)
+		: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory"
+	);
+}
+
+// Sets 64 byte blocks, the destination must be word aligned
+static inline void set_blocks(uint8_t *d, uint8_t c, size_t blocks){
+	__asm__ volatile(
+		"vdup.8 q0, %2\n\t"
+		"vmov q1, q0\n\t"
+		"vmov q2, q0\n\t"
+		"vmov q3, q0\n\t"
+		"1:\n\t"
+		"vstmia %0!, {d0-d7}\n\t"
+		"subs %1, %1, #1\n\t"
+		"bne 1b\n\t"
+		: "+r"(d), "+r"(blocks)
+		: "r"((uint32_t)c)
+		: "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "cc", "memory"
+	);
+}
+
+// ===
+// API
+// ===
+
+void *tru_memcpy(void *dst, const void *src, size_t n){
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	if(n < TRU_MEM_SMALL){
+		copy_small(d, s, n);
+		return dst;
+	}
+
+	// Align the destination
+	size_t head = (0U - (uint32_t)d) & 7U;
+	copy_small(d, s, head);
+	d += head;
+	s += head;
+	n -= head;
+
+	size_t blocks = n / 64U;
+	if(blocks && ((uint32_t)s & 3U) == 0U){
+		copy_blocks_vldm(d, s, blocks, tru_mem_pld_dist);
+	}else if(blocks){
+		copy_blocks_vld1(d, s, blocks, tru_mem_pld_dist);
+	}
+	d += blocks * 64U;
+	s += blocks * 64U;
+
+	copy_small(d, s, n & 63U);
+	return dst;
+}
+
+void *tru_memmove(void *dst, const void *src, size_t n){
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	// A forward copy is safe if the destination is below the source, because each block is loaded before it is stored
+	if(d <= s || d >= s + n) return tru_memcpy(dst, src, n);
+
+	d += n;
+	s += n;
+	if(n < TRU_MEM_SMALL || (((uint32_t)d ^ (uint32_t)s) & 3U) != 0U){
+		copy_small_back(d, s, n);  // Rare, the word copy needs the same alignment
+		return dst;
+	}
+
+	// Align the destination end
+	size_t tail = (uint32_t)d & 7U;
+	copy_small_back(d, s, tail);
+	d -= tail;
+	s -= tail;
+	n -= tail;
+
+	size_t blocks = n / 64U;
+	if(blocks) copy_blocks_back_vldm(d, s, blocks, tru_mem_pld_dist);
+	d -= blocks * 64U;
+	s -= blocks * 64U;
+
+	copy_small_back(d, s, n & 63U);
+	return dst;
+}
+
+void *tru_memset(void *dst, int c, size_t n){
+	uint8_t *d = dst;
+
+	if(n < TRU_MEM_SMALL){
+		set_small(d, (uint8_t)c, n);
+		return dst;
+	}
+
+	size_t head = (0U - (uint32_t)d) & 7U;
+	set_small(d, (uint8_t)c, head);
+	d += head;
+	n -= head;
+
+	size_t blocks = n / 64U;
+	if(blocks) set_blocks(d, (uint8_t)c, blocks);
+	d += blocks * 64U;
+
+	set_small(d, (uint8_t)c, n & 63U);
+	return dst;
+}
+
+// Copy into non-cacheable memory (.dma_buffer), the data is visible to a DMA master on return
+void *tru_memcpy_nt(void *dst, const void *src, size_t n){
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	if(n >= TRU_MEM_SMALL + NT_ALIGN){
+		size_t head = (0U - (uint32_t)d) & (NT_ALIGN - 1U);
+		copy_small(d, s, head);
+		d += head;
+		s += head;
+		n -= head;
+
+		size_t blocks = n / 64U;
+		copy_blocks_nt(d, s, blocks, tru_mem_pld_dist * 2U);  // At least one block
+		d += blocks * 64U;
+		s += blocks * 64U;
+		n &= 63U;
+	}
+	copy_small(d, s, n);
+	__DSB();
+
+	return dst;
+}
+
+#if defined(TRU_MEM_OVERRIDE) && TRU_MEM_OVERRIDE == 1U
+// ===============
+// newlib override
+// ===============
+
+void *memcpy(void *dst, const void *src, size_t n){
+	return tru_memcpy(dst, src, n);
+}
+
+void *memmove(void *dst, const void *src, size_t n){
+	return tru_memmove(dst, src, n);
+}
+
+void *memset(void *dst, int c, size_t n){
+	return tru_memset(dst, c, n);
+}
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 memcpy, memmove and memset with NEON and PLD.
+
+	The copy is dispatched by size and alignment:
+		- below TRU_MEM_SMALL bytes, words if both pointers are word aligned,
+		  otherwise bytes
+		- otherwise the destination is aligned to 8 bytes and the bulk is
+		  copied in 64 byte blocks (eight NEON D registers), with VLDM if the
+		  source is then word aligned, or with VLD1.8 (no alignment needed)
+		- the remainder is copied as a small copy
+	Each block prefetches the two cache lines that are tru_mem_pld_dist
+	bytes ahead of the source with PLD.  The best distance depends on the
+	SDRAM latency, bench/bench_memcpy.c sweeps it (MEMCPY best_pld= line) and
+	it is set with TRU_CFG_MEM_PLD_DIST.
+
+	tru_memcpy_nt() is for large copies into the non-cacheable .dma_buffer
+	section.  ARMv7 has no non-temporal stores, but the non-cacheable
+	destination already bypasses the caches, so the stores are made as
+	aligned 32 byte NEON stores that the store buffer merges into full AXI
+	bursts, the source is prefetched twice as far ahead, and a DSB at the end
+	makes the data visible to a DMA master.
+
+	With TRU_CFG_MEM_OVERRIDE = 1U the newlib memcpy, memmove and memset are
+	replaced by these.  Note that GCC still inlines small copies of a
+	constant size.
+
+	Requires TRU_CFG_NEON = 1U, which enables the NEON unit in SystemInit and
+	makes IRQ_Handler save the NEON registers.  Without it the module is
+	empty, and the override is a build error.
+*/
+
+#ifndef TRU_MEM_H
+#define TRU_MEM_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_NEON) && TRU_NEON == 1U
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Default PLD distance in bytes, a multiple of the cache line size
+#if !defined(TRU_MEM_PLD_DIST)
+	#define TRU_MEM_PLD_DIST 192U
+#endif
+
+// Below this size the block copy is not worth the alignment overhead
+#define TRU_MEM_SMALL 64U
+
+extern uint32_t tru_mem_pld_dist;
+
+void *tru_memcpy(void *dst, const void *src, size_t n);
+void *tru_memmove(void *dst, const void *src, size_t n);
+void *tru_memset(void *dst, int c, size_t n);
+void *tru_memcpy_nt(void *dst, const void *src, size_t n);
+
+#endif
+
+#endif
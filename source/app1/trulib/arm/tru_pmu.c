@@ -0,0 +1,173 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 Performance Monitor Unit (PMU).
+*/
+
+#include "tru_pmu.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+// Default events after tru_pmu_init()
+static tru_pmu_event_t pmu_events[TRU_PMU_NUM_COUNTERS] = {
+	TRU_PMU_EVT_L1D_REFILL,
+	TRU_PMU_EVT_L1I_REFILL,
+	TRU_PMU_EVT_BR_MISPRED,
+	TRU_PMU_EVT_DCACHE_STALL,
+	TRU_PMU_EVT_ICACHE_STALL,
+	TRU_PMU_EVT_INST_RENAME
+};
+
+typedef struct{
+	tru_pmu_event_t event;
+	const char *name;
+}event_name_t;
+
+static const event_name_t event_names[] = {
+	{ TRU_PMU_EVT_SW_INCR,           "sw_incr" },
+	{ TRU_PMU_EVT_L1I_REFILL,        "l1i_refill" },
+	{ TRU_PMU_EVT_ITLB_REFILL,       "itlb_refill" },
+	{ TRU_PMU_EVT_L1D_REFILL,        "l1d_refill" },
+	{ TRU_PMU_EVT_L1D_ACCESS,        "l1d_access" },
+	{ TRU_PMU_EVT_DTLB_REFILL,       "dtlb_refill" },
+	{ TRU_PMU_EVT_LOAD,              "load" },
+	{ TRU_PMU_EVT_STORE,             "store" },
+	{ TRU_PMU_EVT_EXC_TAKEN,         "exc_taken" },
+	{ TRU_PMU_EVT_EXC_RETURN,        "exc_return" },
+	{ TRU_PMU_EVT_CID_WRITE,         "cid_write" },
+	{ TRU_PMU_EVT_PC_WRITE,          "pc_write" },
+	{ TRU_PMU_EVT_BR_IMMED,          "br_immed" },
+	{ TRU_PMU_EVT_UNALIGNED,         "unaligned" },
+	{ TRU_PMU_EVT_BR_MISPRED,        "br_mispred" },
+	{ TRU_PMU_EVT_CYCLES,            "cycles" },
+	{ TRU_PMU_EVT_BR_PRED,           "br_pred" },
+	{ TRU_PMU_EVT_COH_LF_MISS,       "coh_lf_miss" },
+	{ TRU_PMU_EVT_COH_LF_HIT,        "coh_lf_hit" },
+	{ TRU_PMU_EVT_ICACHE_STALL,      "icache_stall" },
+	{ TRU_PMU_EVT_DCACHE_STALL,      "dcache_stall" },
+	{ TRU_PMU_EVT_TLB_STALL,         "tlb_stall" },
+	{ TRU_PMU_EVT_STREX_PASS,        "strex_pass" },
+	{ TRU_PMU_EVT_STREX_FAIL,        "strex_fail" },
+	{ TRU_PMU_EVT_DATA_EVICTION,     "data_eviction" },
+	{ TRU_PMU_EVT_ISSUE_NO_DISPATCH, "issue_no_dispatch" },
+	{ TRU_PMU_EVT_ISSUE_EMPTY,       "issue_empty" },
+	{ TRU_PMU_EVT_INST_RENAME,       "inst_rename" },
+	{ TRU_PMU_EVT_PRED_FUNC_RET,     "pred_func_ret" },
+	{ TRU_PMU_EVT_MAIN_UNIT_INST,    "main_unit_inst" },
+	{ TRU_PMU_EVT_SECOND_UNIT_INST,  "second_unit_inst" },
+	{ TRU_PMU_EVT_LDST_INST,         "ldst_inst" },
+	{ TRU_PMU_EVT_FP_INST,           "fp_inst" },
+	{ TRU_PMU_EVT_NEON_INST,         "neon_inst" },
+	{ TRU_PMU_EVT_PLD_STALL,         "pld_stall" },
+	{ TRU_PMU_EVT_WRITE_STALL,       "write_stall" },
+	{ TRU_PMU_EVT_ITLB_STALL,        "itlb_stall" },
+	{ TRU_PMU_EVT_DTLB_STALL,        "dtlb_stall" },
+	{ TRU_PMU_EVT_MICRO_ITLB_STALL,  "micro_itlb_stall" },
+	{ TRU_PMU_EVT_MICRO_DTLB_STALL,  "micro_dtlb_stall" },
+	{ TRU_PMU_EVT_DMB_STALL,         "dmb_stall" },
+	{ TRU_PMU_EVT_INT_CLK_EN,        "int_clk_en" },
+	{ TRU_PMU_EVT_DE_CLK_EN,         "de_clk_en" },
+	{ TRU_PMU_EVT_ISB,               "isb" },
+	{ TRU_PMU_EVT_DSB,               "dsb" },
+	{ TRU_PMU_EVT_DMB,               "dmb" },
+	{ TRU_PMU_EVT_EXT_IRQ,           "ext_irq" },
+	{ TRU_PMU_EVT_PLE_LINE_DONE,     "ple_line_done" },
+	{ TRU_PMU_EVT_PLE_LINE_SKIP,     "ple_line_skip" },
+	{ TRU_PMU_EVT_PLE_FIFO_FLUSH,    "ple_fifo_flush" },
+	{ TRU_PMU_EVT_PLE_REQ_DONE,      "ple_req_done" },
+	{ TRU_PMU_EVT_PLE_FIFO_OVERFLOW, "ple_fifo_overflow" },
+	{ TRU_PMU_EVT_PLE_REQ_PROG,      "ple_req_prog" }
+};
+
+const char *tru_pmu_event_name(tru_pmu_event_t event){
+	for(uint32_t i = 0U; i < sizeof(event_names) / sizeof(event_names[0]); i++){
+		if(event_names[i].event == event) return event_names[i].name;
+	}
+	return "unknown";
+}
+
+static void apply_events(void){
+	for(uint32_t i = 0U; i < TRU_PMU_NUM_COUNTERS; i++){
+		__write_pmselr(i);
+		__isb();
+		__write_pmxevtyper((uint32_t)pmu_events[i]);
+	}
+	__isb();
+}
+
+// Enables the cycle counter and the six event counters with the default events, on the calling core
+void tru_pmu_init(void){
+	__write_pmcntenclr(0xffffffffU);  // Stop all counters while configuring
+	__write_pmintenclr(0xffffffffU);  // No overflow interrupts
+	__write_pmovsr(0xffffffffU);      // Clear overflow flags
+	apply_events();
+	__write_pmcr(TRU_PMU_PMCR_E_MSK | TRU_PMU_PMCR_P_MSK | TRU_PMU_PMCR_C_MSK);  // Enable and reset, cycle counter counts every cycle
+	__write_pmcntenset(TRU_PMU_CYCLE_CNT_MSK | ((0x1U << TRU_PMU_NUM_COUNTERS) - 1U));
+	__isb();
+}
+
+// Selects the events for the counters, starting from counter 0
+void tru_pmu_set_events(const tru_pmu_event_t *events, uint32_t num){
+	if(num > TRU_PMU_NUM_COUNTERS) num = TRU_PMU_NUM_COUNTERS;
+	for(uint32_t i = 0U; i < num; i++) pmu_events[i] = events[i];
+	apply_events();
+}
+
+tru_pmu_event_t tru_pmu_get_event(uint32_t counter){
+	return pmu_events[counter % TRU_PMU_NUM_COUNTERS];
+}
+
+// Resets all counters to zero on the calling core
+void tru_pmu_reset(void){
+	uint32_t pmcr;
+	__read_pmcr(pmcr);
+	__write_pmcr(pmcr | TRU_PMU_PMCR_P_MSK | TRU_PMU_PMCR_C_MSK);
+	__write_pmovsr(0xffffffffU);
+	__isb();
+}
+
+void tru_pmu_measure_clear(tru_pmu_measure_t *m){
+	memset(&m->acc, 0, sizeof(m->acc));
+}
+
+// Prints the averages per scope
+void tru_pmu_measure_print(const tru_pmu_measure_t *m){
+	const tru_pmu_acc_t *acc = &m->acc;
+
+	printf("PMU %s:\n", m->name ? m->name : "");
+	if(acc->count == 0U) return;
+
+	printf("  count %" PRIu32 ", cycles min %" PRIu32 ", avg %" PRIu32 ", max %" PRIu32 "\n",
+		acc->count, acc->cycles_min, (uint32_t)(acc->cycles / acc->count), acc->cycles_max);
+	for(uint32_t i = 0U; i < TRU_PMU_NUM_COUNTERS; i++){
+		printf("    %-18s avg %" PRIu32 "\n", tru_pmu_event_name(pmu_events[i]), (uint32_t)(acc->counters[i] / acc->count));
+	}
+}
+
+#endif
@@ -0,0 +1,121 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Statistical PC sampling profiler for Arm Cortex-A9.
+*/
+
+#include "tru_prof.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+volatile uint32_t tru_prof_irq_pc;
+
+#if defined(TRU_PROF) && TRU_PROF == 1U
+
+#include "tru_cortex_a9.h"
+#include "tru_time.h"
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+// Code section boundaries from the linker script
+extern uint32_t __text[], __etext[];
+
+static uint32_t prof_bins[TRU_PROF_BINS];
+static uint32_t prof_shift;
+static uint32_t prof_rate;
+static volatile uint32_t prof_samples;
+static volatile uint32_t prof_outside;  // Samples outside of .text, e.g. in RAM functions
+
+static void wd_irq_handler(void){
+	PTIM_REG->wdintrstatus.bits.eventflag = 1;  // Clear interrupt event
+
+	uint32_t offset = tru_prof_irq_pc - (uint32_t)__text;
+	uint32_t bin = offset >> prof_shift;
+	if(tru_prof_irq_pc >= (uint32_t)__text && bin < TRU_PROF_BINS){
+		prof_bins[bin]++;
+	}else{
+		prof_outside++;
+	}
+	prof_samples++;
+}
+
+// Starts sampling on the calling core at the rate in Hz
+int32_t tru_prof_start(uint32_t rate_hz){
+	if(rate_hz == 0U) return -1;
+
+	// Choose the bin size so that the whole .text fits
+	uint32_t size = (uint32_t)__etext - (uint32_t)__text;
+	prof_shift = 2U;  // Arm instructions are 4 bytes
+	while((size >> prof_shift) >= TRU_PROF_BINS) prof_shift++;
+	prof_rate = rate_hz;
+
+	// Private watchdog in timer mode, auto reload
+	uint32_t cpsr = tru_irq_save();
+	PTIM_REG->wdcontrol.val = 0U;
+	PTIM_REG->wdintrstatus.bits.eventflag = 1;
+	PTIM_REG->wdload = tru_time_base.hz / rate_hz - 1U;
+	IRQ_SetHandler(PTIM_WD_IRQ_ID, wd_irq_handler);
+	IRQ_Enable(PTIM_WD_IRQ_ID);
+	PTIM_REG->wdcontrol.val = 0x7U;  // Timer enable, auto reload, IRQ enable, timer mode
+	tru_irq_restore(cpsr);
+
+	return 0;
+}
+
+void tru_prof_stop(void){
+	PTIM_REG->wdcontrol.val = 0U;
+	IRQ_Disable(PTIM_WD_IRQ_ID);
+	PTIM_REG->wdintrstatus.bits.eventflag = 1;
+}
+
+void tru_prof_clear(void){
+	uint32_t cpsr = tru_irq_save();
+	memset(prof_bins, 0, sizeof(prof_bins));
+	prof_samples = 0U;
+	prof_outside = 0U;
+	tru_irq_restore(cpsr);
+}
+
+// Prints the non-empty bins, one per line, for the host script
+void tru_prof_dump(void){
+	uint32_t mpidr;
+	__read_mpidr(mpidr);
+
+	printf("PROF BEGIN core=%" PRIu32 " base=0x%08" PRIx32 " shift=%" PRIu32 " rate=%" PRIu32 " samples=%" PRIu32 " outside=%" PRIu32 "\n",
+		mpidr & 0x3U, (uint32_t)__text, prof_shift, prof_rate, prof_samples, prof_outside);
+	for(uint32_t i = 0U; i < TRU_PROF_BINS; i++){
+		if(prof_bins[i]) printf("PROF %" PRIx32 " %" PRIu32 "\n", i, prof_bins[i]);
+	}
+	printf("PROF END\n");
+}
+
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cooperative run-to-completion task scheduler for Arm Cortex-A9.
+*/
+
+#include "tru_sched.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include "tru_idle.h"
+#include "tru_timer.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+static tru_sched_task_t tasks[TRU_SCHED_MAX_TASKS];
+static volatile uint32_t ready;  // Bit n set = task n is ready
+static tru_timer_t tick_timer;
+
+int32_t tru_sched_task_init(uint32_t prio, tru_sched_func_t func, void *arg, uint32_t deadline){
+	if(prio >= TRU_SCHED_MAX_TASKS || func == NULL) return -1;
+
+	tru_sched_task_t *task = &tasks[prio];
+	if(task->func != NULL) return -1;  // Slot already taken
+
+	memset(task, 0, sizeof(tru_sched_task_t));
+	task->arg = arg;
+	task->deadline = deadline;
+	__atomic_store_n(&task->func, func, __ATOMIC_RELEASE);
+
+	// The global timer is used for the accounting
+	if(!gtim_is_enabled()) gtim_enable();
+
+	return 0;
+}
+
+void tru_sched_task_deinit(uint32_t prio){
+	if(prio >= TRU_SCHED_MAX_TASKS) return;
+
+	__atomic_store_n(&tasks[prio].func, NULL, __ATOMIC_RELEASE);
+	__atomic_fetch_and(&ready, ~(0x1U << prio), __ATOMIC_RELAXED);
+}
+
+// Safe to call from IRQ handlers
+void tru_sched_post(uint32_t prio, uint32_t events){
+	if(prio >= TRU_SCHED_MAX_TASKS) return;
+
+	tru_sched_task_t *task = &tasks[prio];
+	__atomic_fetch_or(&task->events, events, __ATOMIC_RELAXED);
+	if(__atomic_fetch_add(&task->pending, 1U, __ATOMIC_RELAXED) == 0U){
+		task->post_time = gtim_get_counter();
+	}
+	__atomic_fetch_or(&ready, 0x1U << prio, __ATOMIC_RELEASE);
+}
+
+// Runs the highest priority ready task, returns false if there was none
+bool tru_sched_dispatch(void){
+	uint32_t r = __atomic_load_n(&ready, __ATOMIC_ACQUIRE);
+	if(r == 0U) return false;
+
+	uint32_t prio = __builtin_ctz(r);
+	__atomic_fetch_and(&ready, ~(0x1U << prio), __ATOMIC_ACQUIRE);
+
+	tru_sched_task_t *task = &tasks[prio];
+	tru_sched_func_t func = __atomic_load_n(&task->func, __ATOMIC_ACQUIRE);
+
+	// Read the post time before taking the pending count, a post after the exchange belongs to the next run
+	uint64_t post_time = task->post_time;
+	uint32_t events = __atomic_exchange_n(&task->events, 0U, __ATOMIC_ACQUIRE);
+	uint32_t count = __atomic_exchange_n(&task->pending, 0U, __ATOMIC_ACQUIRE);
+	if(count == 0U || func == NULL) return true;  // Already serviced by a previous run
+
+	uint64_t start = gtim_get_counter();
+	func(task->arg, events);
+	uint64_t end = gtim_get_counter();
+
+	tru_sched_stats_t *stats = &task->stats;
+	uint32_t latency = (uint32_t)(start - post_time);
+	uint32_t exec = (uint32_t)(end - start);
+	stats->runs++;
+	stats->coalesced += count - 1U;
+	stats->total_exec += exec;
+	if(latency > stats->max_latency) stats->max_latency = latency;
+	if(exec > stats->max_exec) stats->max_exec = exec;
+	if(task->deadline && (end - post_time) > task->deadline) stats->overruns++;
+
+	return true;
+}
+
+// Runs the ready tasks forever and sleeps in WFI when there are none.  IRQs must be enabled
+void tru_sched_run(void){
+	while(1){
+		while(tru_sched_dispatch());
+		tru_idle_until(&ready);
+	}
+}
+
+// =============
+// Periodic tick
+// =============
+
+static void tick_timer_callback(void *arg){
+	tru_sched_post((uint32_t)arg, TRU_SCHED_EVT_TICK);
+}
+
+// Posts TRU_SCHED_EVT_TICK to the task every period (global timer ticks).  Uses a periodic software timer (see tru_timer.h)
+int32_t tru_sched_tick_start(uint32_t prio, uint32_t period){
+	if(prio >= TRU_SCHED_MAX_TASKS || period == 0U) return -1;
+
+	if(tick_timer.func != NULL) tru_timer_stop(&tick_timer);  // Already initialised?
+	tru_timer_init(&tick_timer, tick_timer_callback, (void *)prio);
+	return tru_timer_start(&tick_timer, period, period);
+}
+
+void tru_sched_tick_stop(void){
+	if(tick_timer.func != NULL) tru_timer_stop(&tick_timer);
+}
+
+// ==========
+// Statistics
+// ==========
+
+const tru_sched_stats_t *tru_sched_get_stats(uint32_t prio){
+	if(prio >= TRU_SCHED_MAX_TASKS) return NULL;
+	return &tasks[prio].stats;
+}
+
+void tru_sched_print_stats(void){
+	printf("Scheduler stats (global timer ticks):\n");
+	for(uint32_t i = 0U; i < TRU_SCHED_MAX_TASKS; i++){
+		if(tasks[i].func == NULL) continue;
+
+		tru_sched_stats_t *stats = &tasks[i].stats;
+		printf("  Task %" PRIu32 ": runs %" PRIu32 ", coalesced %" PRIu32 ", overruns %" PRIu32 ", max latency %" PRIu32 ", max exec %" PRIu32 ", avg exec %" PRIu32 "\n",
+			i, stats->runs, stats->coalesced, stats->overruns, stats->max_latency, stats->max_exec, stats->runs ? (uint32_t)(stats->total_exec / stats->runs) : 0U);
+	}
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cooperative run-to-completion task scheduler for Arm Cortex-A9.
+
+	Tasks are plain functions that run to completion, there is no context
+	switch and no per-task stack.  A task is made ready by posting an event to
+	it, normally from an IRQ handler.  Each task has a fixed slot which is also
+	its priority (0 = highest), and the ready tasks are held in a lock-free
+	bitmap, so picking the next task is a single count trailing zeros.  Posting
+	to a task that is already ready coalesces the events into one run, the
+	event bits are OR'd together and the number of coalesced posts is counted.
+
+	Note, this is not a queue of posted items.  Each task has one pending run,
+	so a task that must see every item (e.g. received bytes) should keep them
+	in its own buffer and use the post only to be woken.
+
+	Timing accounting uses the global timer.  Latency is the time from the
+	first unserviced post to the start of the run, and a run that completes
+	later than the task's deadline (relative to the post) is counted as an
+	overrun.
+
+	When no task is ready the scheduler sleeps in WFI (see tru_idle.h).  The
+	optional periodic tick is a software timer (see tru_timer.h), in tickless
+	mode it costs no more interrupts than the tick itself.
+*/
+
+#ifndef TRU_SCHED_H
+#define TRU_SCHED_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRU_SCHED_MAX_TASKS 32U
+
+// Event bit posted by the periodic tick
+#define TRU_SCHED_EVT_TICK (0x1U << 31U)
+
+typedef void (*tru_sched_func_t)(void *arg, uint32_t events);
+
+typedef struct{
+	uint32_t runs;
+	uint32_t coalesced;    // Posts merged into an already pending run
+	uint32_t overruns;     // Runs completed after the deadline
+	uint32_t max_latency;  // Post to start of run, global timer ticks
+	uint32_t max_exec;     // Run time, global timer ticks
+	uint64_t total_exec;   // Global timer ticks
+}tru_sched_stats_t;
+
+typedef struct{
+	tru_sched_func_t func;
+	void *arg;
+	uint32_t deadline;           // Relative to the post, global timer ticks, 0 = no deadline
+	volatile uint32_t pending;   // Number of posts since the last run
+	volatile uint32_t events;    // OR'd event bits since the last run
+	volatile uint64_t post_time; // Time of the first post since the last run
+	tru_sched_stats_t stats;
+}tru_sched_task_t;
+
+int32_t tru_sched_task_init(uint32_t prio, tru_sched_func_t func, void *arg, uint32_t deadline);
+void tru_sched_task_deinit(uint32_t prio);
+void tru_sched_post(uint32_t prio, uint32_t events);
+bool tru_sched_dispatch(void);
+void __attribute__((noreturn)) tru_sched_run(void);
+int32_t tru_sched_tick_start(uint32_t prio, uint32_t period);
+void tru_sched_tick_stop(void);
+const tru_sched_stats_t *tru_sched_get_stats(uint32_t prio);
+void tru_sched_print_stats(void);
+
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 processor mode stack usage (high-water mark) measurement.
+*/
+
+#include "tru_stack.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_STACK_PAINT) && TRU_STACK_PAINT == 1U
+
+#include "tru_cortex_a9.h"
+#include <stdio.h>
+#include <inttypes.h>
+
+// Stack boundaries from the linker script
+extern uint32_t __FIQ_STACK_BASE[], __FIQ_STACK_LIMIT[];
+extern uint32_t __IRQ_STACK_BASE[], __IRQ_STACK_LIMIT[];
+extern uint32_t __SVC_STACK_BASE[], __SVC_STACK_LIMIT[];
+extern uint32_t __ABT_STACK_BASE[], __ABT_STACK_LIMIT[];
+extern uint32_t __UND_STACK_BASE[], __UND_STACK_LIMIT[];
+extern uint32_t __SYS_STACK_BASE[], __SYS_STACK_LIMIT[];
+
+static uint32_t *const stack_bounds[TRU_STACK_MODE_COUNT][2] = {
+	{ __FIQ_STACK_BASE, __FIQ_STACK_LIMIT },
+	{ __IRQ_STACK_BASE, __IRQ_STACK_LIMIT },
+	{ __SVC_STACK_BASE, __SVC_STACK_LIMIT },
+	{ __ABT_STACK_BASE, __ABT_STACK_LIMIT },
+	{ __UND_STACK_BASE, __UND_STACK_LIMIT },
+	{ __SYS_STACK_BASE, __SYS_STACK_LIMIT }
+};
+
+static const char *const stack_names[TRU_STACK_MODE_COUNT] = { "FIQ", "IRQ", "SVC", "ABT", "UND", "SYS" };
+
+void tru_stack_get_usage(tru_stack_mode_t mode, tru_stack_usage_t *usage){
+	volatile uint32_t *addr = stack_bounds[mode][0];
+	volatile uint32_t *limit = stack_bounds[mode][1];
+
+	// Find the lowest word that is no longer the paint pattern
+	while(addr < limit && *addr == TRU_STACK_PAINT_PATTERN) addr++;
+
+	usage->base = (uint32_t)stack_bounds[mode][0];
+	usage->limit = (uint32_t)limit;
+	usage->size = usage->limit - usage->base;
+	usage->used = usage->limit - (uint32_t)addr;
+	usage->overflow = (usage->used == usage->size);
+}
+
+void tru_stack_get_report(tru_stack_report_t *report){
+	uint32_t mpidr;
+	__read_mpidr(mpidr);  // Read MPIDR register to get current processor number
+	report->cpu = mpidr & 0x3U;
+
+	for(uint32_t i = 0U; i < TRU_STACK_MODE_COUNT; i++){
+		tru_stack_get_usage((tru_stack_mode_t)i, &report->mode[i]);
+	}
+}
+
+void tru_stack_print_report(void){
+	tru_stack_report_t report;
+	tru_stack_get_report(&report);
+
+	printf("Stack usage (core %" PRIu32 "):\n", report.cpu);
+	for(uint32_t i = 0U; i < TRU_STACK_MODE_COUNT; i++){
+		printf("  %s: %" PRIu32 "/%" PRIu32 " bytes%s\n", stack_names[i], report.mode[i].used, report.mode[i].size, report.mode[i].overflow ? " OVERFLOW" : "");
+	}
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Monotonic time base for Arm Cortex-A9 using the global timer.
+*/
+
+#include "tru_time.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+	#include "c5soc/tru_c5soc_hps_clkmgr_ll.h"
+#endif
+
+// Default for the usual 800MHz MPU clock, until tru_time_init() is called
+tru_time_base_t tru_time_base = {
+	.hz = 200000000U,
+	.tick2ns = { .mult = 0xa0000000U, .shift = 29U },
+	.tick2us = { .mult = 0x0147ae14U, .shift = 32U },
+	.ns2tick = { .mult = 0x33333333U, .shift = 32U },
+	.us2tick = { .mult = 0xc8000000U, .shift = 24U }
+};
+
+// Finds the largest shift (most precision) where the multiplier for out = in * num / den still fits in 32 bits
+static void calc_conv(tru_time_conv_t *conv, uint32_t num, uint32_t den){
+	uint32_t shift = 32U;
+	uint64_t mult;
+
+	while(1){
+		mult = (((uint64_t)num << shift) + (den >> 1U)) / den;  // Rounded
+		if(mult <= 0xffffffffU || shift == 0U) break;
+		shift--;
+	}
+
+	conv->mult = (uint32_t)mult;
+	conv->shift = shift;
+}
+
+// hz: global timer clock, 0 = read from the clock manager (or the fixed clock of the board)
+void tru_time_init(uint32_t hz){
+	if(hz == 0U){
+#if defined(TRU_PERIPH_CLK_HZ)
+		hz = TRU_PERIPH_CLK_HZ;  // Fixed by the board, which has no clock manager
+#elif(TRU_TARGET == TRU_TARGET_C5SOC)
+		hz = (uint32_t)get_mpu_peri_clk(TRU_HPS_INPUT_CLK_HZ).fout;
+#else
+		hz = tru_time_base.hz;
+#endif
+	}
+
+	tru_time_base.hz = hz;
+	calc_conv(&tru_time_base.tick2ns, 1000000000U, hz);
+	calc_conv(&tru_time_base.tick2us, 1000000U, hz);
+	calc_conv(&tru_time_base.ns2tick, hz, 1000000000U);
+	calc_conv(&tru_time_base.us2tick, hz, 1000000U);
+
+	if(!gtim_is_enabled()) gtim_enable();
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Monotonic time base for Arm Cortex-A9 using the global timer.
+
+	The global timer runs from the peripheral base clock (PERIPHCLK), which is
+	1/4 of the MPU clock.  The real clock is read once from the clock manager
+	by tru_time_init(), so the conversions follow the PLL settings made by
+	U-Boot instead of assuming 800MHz / 4 = 200MHz.
+
+	Conversions use precomputed fixed-point multipliers:
+		out = (in * mult) >> shift
+	computed in two halves so that the full 64-bit input range works without
+	overflow and without a division.
+*/
+
+#ifndef TRU_TIME_H
+#define TRU_TIME_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+
+typedef struct{
+	uint32_t mult;
+	uint32_t shift;
+}tru_time_conv_t;
+
+typedef struct{
+	uint32_t hz;              // Global timer clock
+	tru_time_conv_t tick2ns;
+	tru_time_conv_t tick2us;
+	tru_time_conv_t ns2tick;
+	tru_time_conv_t us2tick;
+}tru_time_base_t;
+
+extern tru_time_base_t tru_time_base;
+
+void tru_time_init(uint32_t hz);
+
+static inline uint64_t tru_time_conv(const tru_time_conv_t *conv, uint64_t in){
+	uint64_t mask = (1ULL << conv->shift) - 1U;
+	return (in >> conv->shift) * conv->mult + (((in & mask) * conv->mult) >> conv->shift);
+}
+
+// Current time in global timer ticks
+static inline uint64_t tru_time_ticks(void){
+	return gtim_get_counter();
+}
+
+static inline uint64_t tru_time_ticks_to_ns(uint64_t ticks){
+	return tru_time_conv(&tru_time_base.tick2ns, ticks);
+}
+
+static inline uint64_t tru_time_ticks_to_us(uint64_t ticks){
+	return tru_time_conv(&tru_time_base.tick2us, ticks);
+}
+
+static inline uint64_t tru_time_ns_to_ticks(uint64_t ns){
+	return tru_time_conv(&tru_time_base.ns2tick, ns);
+}
+
+static inline uint64_t tru_time_us_to_ticks(uint64_t us){
+	return tru_time_conv(&tru_time_base.us2tick, us);
+}
+
+// Current time in nanoseconds since the global timer started
+static inline uint64_t tru_time_ns(void){
+	return tru_time_ticks_to_ns(gtim_get_counter());
+}
+
+// Current time in microseconds since the global timer started
+static inline uint64_t tru_time_us(void){
+	return tru_time_ticks_to_us(gtim_get_counter());
+}
+
+// Busy-wait delays, at least the requested time (rounded up to the next tick)
+static inline void tru_time_delay_ticks(uint64_t ticks){
+	uint64_t end = gtim_get_counter() + ticks + 1U;
+	while(gtim_get_counter() < end);
+}
+
+static inline void tru_ndelay(uint32_t ns){
+	tru_time_delay_ticks(tru_time_ns_to_ticks(ns));
+}
+
+static inline void tru_udelay(uint32_t us){
+	tru_time_delay_ticks(tru_time_us_to_ticks(us));
+}
+
+static inline void tru_mdelay(uint32_t ms){
+	tru_time_delay_ticks(tru_time_us_to_ticks((uint64_t)ms * 1000U));
+}
+
+#endif
+
+#endif
@@ -0,0 +1,267 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Software timer service for Arm Cortex-A9 using the private timer.
+*/
+
+#include "tru_timer.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+// Minimum private timer load, so a deadline that is already due still gets a fresh interrupt
+#define TRU_TIMER_MIN_LOAD 16U
+
+static tru_timer_t *heap[TRU_TIMER_MAX_ACTIVE];
+static uint32_t heap_size;
+static uint32_t tick_period;  // 0 = tickless
+static bool service_init;
+static volatile uint32_t irq_count;
+
+// ================
+// Min-heap helpers
+// ================
+
+static inline void heap_place(uint32_t i, tru_timer_t *timer){
+	heap[i] = timer;
+	timer->heap_index = i;
+}
+
+static void heap_up(uint32_t i){
+	tru_timer_t *timer = heap[i];
+	while(i){
+		uint32_t parent = (i - 1U) >> 1U;
+		if(heap[parent]->expiry <= timer->expiry) break;
+		heap_place(i, heap[parent]);
+		i = parent;
+	}
+	heap_place(i, timer);
+}
+
+static void heap_down(uint32_t i){
+	tru_timer_t *timer = heap[i];
+	while(1){
+		uint32_t child = (i << 1U) + 1U;
+		if(child >= heap_size) break;
+		if(child + 1U < heap_size && heap[child + 1U]->expiry < heap[child]->expiry) child++;
+		if(timer->expiry <= heap[child]->expiry) break;
+		heap_place(i, heap[child]);
+		i = child;
+	}
+	heap_place(i, timer);
+}
+
+static void heap_remove(tru_timer_t *timer){
+	uint32_t i = timer->heap_index;
+	timer->heap_index = TRU_TIMER_INACTIVE;
+	heap_size--;
+	if(i == heap_size) return;  // Was the last element
+
+	// Move the last element into the hole and restore the heap order, it can only move one way
+	heap_place(i, heap[heap_size]);
+	heap_up(i);
+	heap_down(i);
+}
+
+static bool heap_insert(tru_timer_t *timer){
+	if(heap_size >= TRU_TIMER_MAX_ACTIVE) return false;
+
+	heap_place(heap_size, timer);
+	heap_size++;
+	heap_up(heap_size - 1U);
+	return true;
+}
+
+// ===================
+// Private timer setup
+// ===================
+
+// Tickless: load the private timer for the next deadline only, or stop it when there is none.  Call with IRQs masked
+static void reprogram(void){
+	if(tick_period) return;
+
+	ptim_disable();
+	if(heap_size == 0U) return;
+
+	uint64_t now = gtim_get_counter();
+	uint64_t delta = (heap[0]->expiry > now) ? heap[0]->expiry - now : 0U;
+	if(delta < TRU_TIMER_MIN_LOAD) delta = TRU_TIMER_MIN_LOAD;
+	if(delta > 0xffffffffU) delta = 0xffffffffU;  // Longer deadlines take an intermediate interrupt
+
+	PTIM_REG->load = (uint32_t)delta;
+	ptim_enable();
+}
+
+static void ptim_irq_handler(void){
+	ptim_clear_event();
+	irq_count++;
+
+	uint64_t now = gtim_get_counter();
+	while(heap_size && heap[0]->expiry <= now){
+		tru_timer_t *timer = heap[0];
+		heap_remove(timer);
+
+		// Record lateness (jitter)
+		uint64_t start = gtim_get_counter();
+		uint32_t late = (uint32_t)(start - timer->expiry);
+		tru_timer_stats_t *stats = &timer->stats;
+		stats->count++;
+		stats->total += late;
+		if(late < stats->min) stats->min = late;
+		if(late > stats->max) stats->max = late;
+
+		// Re-arm a periodic timer before the callback, so the callback may stop it
+		if(timer->period){
+			timer->expiry += timer->period;
+			if(timer->expiry <= start){
+				// Callback was later than a whole period, skip the missed expiries
+				uint64_t n = (start - timer->expiry) / timer->period + 1U;
+				stats->missed += (uint32_t)n;
+				timer->expiry += n * timer->period;
+			}
+			heap_insert(timer);
+		}
+
+		timer->func(timer->arg);
+		now = gtim_get_counter();
+	}
+
+	reprogram();
+}
+
+// tick: 0 = tickless, else the private timer period in ticks (same clock as the global timer)
+int32_t tru_timer_service_init(uint32_t tick){
+	uint32_t cpsr = tru_irq_save();
+
+	tick_period = tick;
+	if(!gtim_is_enabled()) gtim_enable();
+
+	ptim_setup_basic_mode();
+	ptim_clear_event();
+	PTIM_REG->control.val |= PTIM_CONTROL_IRQ_ENABLE_MSK;
+	if(tick){
+		PTIM_REG->load = tick - 1U;
+		PTIM_REG->control.val |= PTIM_CONTROL_AUTORELOAD_MSK;
+	}
+
+	IRQ_SetHandler(PTIM_IRQ_ID, ptim_irq_handler);
+	IRQ_Enable(PTIM_IRQ_ID);
+	service_init = true;
+
+	if(tick){
+		ptim_enable();
+	}else{
+		reprogram();
+	}
+
+	tru_irq_restore(cpsr);
+	return 0;
+}
+
+bool tru_timer_service_is_init(void){
+	return service_init;
+}
+
+// Number of private timer interrupts taken, to compare the interrupt load of the modes
+uint32_t tru_timer_service_irq_count(void){
+	return irq_count;
+}
+
+// ===========
+// Timer calls
+// ===========
+
+void tru_timer_init(tru_timer_t *timer, tru_timer_func_t func, void *arg){
+	memset(timer, 0, sizeof(tru_timer_t));
+	timer->func = func;
+	timer->arg = arg;
+	timer->heap_index = TRU_TIMER_INACTIVE;
+	timer->stats.min = UINT32_MAX;
+}
+
+// Starts (or restarts) the timer at an absolute global timer value.  period: 0 = one-shot
+int32_t tru_timer_start_at(tru_timer_t *timer, uint64_t expiry, uint32_t period){
+	if(!service_init) tru_timer_service_init(0U);
+
+	uint32_t cpsr = tru_irq_save();
+
+	if(tru_timer_is_active(timer)) heap_remove(timer);
+	timer->expiry = expiry;
+	timer->period = period;
+	if(!heap_insert(timer)){
+		tru_irq_restore(cpsr);
+		return -1;
+	}
+	if(timer->heap_index == 0U) reprogram();  // New earliest deadline
+
+	tru_irq_restore(cpsr);
+	return 0;
+}
+
+// Starts (or restarts) the timer relative to now, all values in global timer ticks.  period: 0 = one-shot
+int32_t tru_timer_start(tru_timer_t *timer, uint64_t delay, uint32_t period){
+	if(!gtim_is_enabled()) gtim_enable();
+	return tru_timer_start_at(timer, gtim_get_counter() + delay, period);
+}
+
+void tru_timer_stop(tru_timer_t *timer){
+	uint32_t cpsr = tru_irq_save();
+
+	if(tru_timer_is_active(timer)){
+		bool first = (timer->heap_index == 0U);
+		heap_remove(timer);
+		if(first) reprogram();
+	}
+
+	tru_irq_restore(cpsr);
+}
+
+void tru_timer_reset_stats(tru_timer_t *timer){
+	uint32_t cpsr = tru_irq_save();
+	memset(&timer->stats, 0, sizeof(tru_timer_stats_t));
+	timer->stats.min = UINT32_MAX;
+	tru_irq_restore(cpsr);
+}
+
+void tru_timer_print_stats(const tru_timer_t *timer, const char *name){
+	const tru_timer_stats_t *stats = &timer->stats;
+
+	if(stats->count){
+		printf("Timer %s: count %" PRIu32 ", missed %" PRIu32 ", lateness min %" PRIu32 ", avg %" PRIu32 ", max %" PRIu32 " (global timer ticks)\n",
+			name, stats->count, stats->missed, stats->min, (uint32_t)(stats->total / stats->count), stats->max);
+	}else{
+		printf("Timer %s: count 0\n", name);
+	}
+}
+
+#endif
@@ -0,0 +1,162 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Function entry/exit tracer for Arm Cortex-A9.
+*/
+
+#include "tru_trace.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_TRACE) && TRU_TRACE == 1U
+
+#include "tru_cortex_a9.h"
+#include "tru_time.h"
+#include "tru_amp_shared.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+static tru_trace_entry_t trace_ring[TRU_TRACE_ENTRIES];
+static volatile uint32_t trace_head;  // Total number of entries written, the slot is head % entries
+static volatile bool trace_on;
+
+void __cyg_profile_func_enter(void *fn, void *call_site) __attribute__((no_instrument_function));
+void __cyg_profile_func_exit(void *fn, void *call_site) __attribute__((no_instrument_function));
+
+static inline void __attribute__((always_inline)) trace_log(void *fn, uint32_t type){
+	if(!trace_on) return;
+
+	uint32_t i = __atomic_fetch_add(&trace_head, 1U, __ATOMIC_RELAXED) & (TRU_TRACE_ENTRIES - 1U);
+	tru_trace_entry_t *entry = &trace_ring[i];
+	entry->ts = gtim_get_counter();
+	entry->fn = (uint32_t)fn;
+	entry->type = type;
+}
+
+void __cyg_profile_func_enter(void *fn, void *call_site){
+	trace_log(fn, TRU_TRACE_ENTER);
+}
+
+void __cyg_profile_func_exit(void *fn, void *call_site){
+	trace_log(fn, TRU_TRACE_EXIT);
+}
+
+static inline uint32_t __attribute__((always_inline)) trace_cpu(void){
+	uint32_t mpidr;
+	__read_mpidr(mpidr);  // Read MPIDR register to get current processor number
+	return mpidr & 0x3U;
+}
+
+void tru_trace_start(void){
+	volatile uint32_t *state = &tru_amp_shared.trace_state[trace_cpu()];
+
+	if(!gtim_is_enabled()) gtim_enable();
+	if(*state == TRU_TRACE_STATE_OFF) *state = TRU_TRACE_STATE_ON;
+	trace_on = true;
+}
+
+void tru_trace_stop(void){
+	trace_on = false;
+	__dmb();
+}
+
+void tru_trace_clear(void){
+	trace_head = 0U;
+}
+
+// Prints the ring, oldest entry first
+static void trace_print(uint32_t cpu){
+	uint32_t head = trace_head;
+	uint32_t count = (head < TRU_TRACE_ENTRIES) ? head : TRU_TRACE_ENTRIES;
+	uint32_t start = head - count;
+
+	printf("TRACE BEGIN core=%" PRIu32 " hz=%" PRIu32 " count=%" PRIu32 " dropped=%" PRIu32 "\n", cpu, tru_time_base.hz, count, head - count);
+	for(uint32_t i = start; i != head; i++){
+		tru_trace_entry_t *entry = &trace_ring[i & (TRU_TRACE_ENTRIES - 1U)];
+		printf("TRACE %c %08" PRIx32 " %08" PRIx32 "%08" PRIx32 "\n", entry->type == TRU_TRACE_ENTER ? 'E' : 'X', entry->fn, (uint32_t)(entry->ts >> 32U), (uint32_t)entry->ts);
+	}
+	printf("TRACE END\n");
+	fflush(stdout);
+}
+
+// Tracing is stopped while printing, so the printing itself is not traced
+void tru_trace_dump(void){
+	bool was_on = trace_on;
+	tru_trace_stop();
+
+	trace_print(trace_cpu());
+
+	if(was_on) tru_trace_start();
+}
+
+// Clears the dump handshake of the other cores, call before releasing them
+void tru_trace_amp_init(void){
+	uint32_t cpu = trace_cpu();
+
+	for(uint32_t i = 0U; i < TRU_AMP_CPU_MAX; i++){
+		if(i != cpu) tru_amp_shared.trace_state[i] = TRU_TRACE_STATE_OFF;
+	}
+	__dmb();
+}
+
+// Prints the rings of the cores in turn.  Core 0 is the controlling core, it prints first and waits up to timeout_us for each other core.
+// The other cores wait up to timeout_us for the request of core 0
+void tru_trace_dump_amp(uint32_t timeout_us){
+	volatile uint32_t *state = tru_amp_shared.trace_state;
+	uint32_t cpu = trace_cpu();
+	bool was_on = trace_on;
+	tru_trace_stop();
+
+	if(cpu == 0U){
+		trace_print(cpu);
+
+		for(uint32_t i = 1U; i < TRU_AMP_CPU_MAX; i++){
+			if(state[i] != TRU_TRACE_STATE_ON) continue;  // Not tracing, or not started
+
+			state[i] = TRU_TRACE_STATE_DUMP;
+			__dsb();  // Ensure the write is visible before the event
+			__sev();  // Wake up the other core if it is waiting
+
+			uint64_t end = tru_time_us() + timeout_us;
+			while(state[i] != TRU_TRACE_STATE_DONE && tru_time_us() < end);
+		}
+	}else{
+		// Polled rather than WFE, which would not wake up for the timeout
+		uint64_t end = tru_time_us() + timeout_us;
+		while(state[cpu] != TRU_TRACE_STATE_DUMP && tru_time_us() < end);
+
+		if(state[cpu] == TRU_TRACE_STATE_DUMP){
+			trace_print(cpu);  // Flushed, the rest is queued in the UART FIFO ahead of anything the controlling core prints next
+
+			state[cpu] = TRU_TRACE_STATE_DONE;
+			__dsb();
+			__sev();
+		}
+	}
+
+	if(was_on) tru_trace_start();
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Function entry/exit tracer for Arm Cortex-A9.
+
+	Build with the fi=1 make option, which compiles with -finstrument-functions
+	and defines TRU_TRACE=1.  The compiler then calls the hooks
+	__cyg_profile_func_enter/exit on every function entry and exit, and the
+	hooks log the function address with a global timer timestamp into a ring
+	buffer.  Each core (app) has its own ring, and the global timer is shared
+	by both cores, so the timelines of the two cores can be merged.
+
+	The ring slot is reserved with an atomic increment, so interrupt handlers
+	may trace into the same ring.  When the ring is full the oldest entries
+	are overwritten (flight recorder).
+
+	tru_trace_dump() prints the ring as text lines, which are converted into
+	Chrome trace JSON (chrome://tracing or https://ui.perfetto.dev) with:
+		scripts-py/trace_to_json.py <captured uart log> <app1 elf> [app2 elf]
+
+	Both cores print to the same UART, so in an AMP system the rings are
+	printed one after another with tru_trace_dump_amp().  The controlling core
+	(app1) calls tru_trace_amp_init() before releasing the other core, and
+	later tru_trace_dump_amp(), which prints its own ring and then requests
+	the dump of each other core that is tracing through the shared memory
+	(see tru_amp_shared.h).  The other core (app2) calls tru_trace_dump_amp(),
+	which waits for the request, prints its ring and returns.  Both wait up
+	to the given timeout, so neither core hangs when the other one does not
+	trace or stops, and on a timeout the other core does not print.
+*/
+
+#ifndef TRU_TRACE_H
+#define TRU_TRACE_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+
+// Number of ring entries, must be a power of 2
+#ifndef TRU_TRACE_ENTRIES
+	#define TRU_TRACE_ENTRIES 4096U
+#endif
+
+#define TRU_TRACE_ENTER 0U
+#define TRU_TRACE_EXIT  1U
+
+// Dump handshake state of each core, in tru_amp_shared_t
+#define TRU_TRACE_STATE_OFF  0U  // Not tracing
+#define TRU_TRACE_STATE_ON   1U  // Tracing, the ring has not been printed
+#define TRU_TRACE_STATE_DUMP 2U  // Dump requested by the controlling core
+#define TRU_TRACE_STATE_DONE 3U  // Ring printed
+
+typedef struct{
+	uint32_t fn;    // Function address
+	uint32_t type;  // TRU_TRACE_ENTER or TRU_TRACE_EXIT
+	uint64_t ts;    // Global timer ticks
+}tru_trace_entry_t;
+
+#if defined(TRU_TRACE) && TRU_TRACE == 1U
+	void tru_trace_start(void) __attribute__((no_instrument_function));
+	void tru_trace_stop(void) __attribute__((no_instrument_function));
+	void tru_trace_clear(void) __attribute__((no_instrument_function));
+	void tru_trace_dump(void) __attribute__((no_instrument_function));
+	void tru_trace_amp_init(void) __attribute__((no_instrument_function));
+	void tru_trace_dump_amp(uint32_t timeout_us) __attribute__((no_instrument_function));
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+*/
+
+#include "tru_bsp_qemu_vexpressa9.h"
+
+#if(TRU_BOARD == TRU_BOARD_QEMU_VEXPRESSA9)
+
+#include "tru_iom.h"
+
+// PL011 registers
+#define PL011_DR          0x00U
+#define PL011_FR          0x18U
+#define PL011_FR_TXFF_MSK (0x1U << 5U)
+
+#ifdef SEMIHOSTING
+	extern void initialise_monitor_handles(void);  // Reference function header from the external Semihosting library
+#else
+	#if (defined(TRU_PRINT_UART0) && TRU_PRINT_UART0 == 1U) || (defined(TRU_PRINT_UART1) && TRU_PRINT_UART1 == 1U)
+		int __io_putchar(int ch){
+			while(iom_rd32((uint32_t *)(TRU_QEMU_UART0_BASE + PL011_FR)) & PL011_FR_TXFF_MSK);  // Wait while the transmit FIFO is full
+			iom_wr32((uint32_t *)(TRU_QEMU_UART0_BASE + PL011_DR), (uint32_t)ch);
+			return ch;
+		}
+	#endif
+
+	// Semihosting SYS_EXIT, so that QEMU (started with -semihosting) exits when the application ends.  Overrides the weak version in tru_newlib_ext.c
+	void __attribute__((noreturn)) _exit(int status){
+		(void)status;
+		__asm__ volatile(
+			"MOV r0, #0x18     \n"  // SYS_EXIT
+			"LDR r1, =0x20026  \n"  // ADP_Stopped_ApplicationExit
+			"SVC 0x123456      \n"
+			::: "r0", "r1", "memory"
+		);
+		while(1);  // Not reached.  Without -semihosting, the SVC is taken by SVC_Handler instead
+	}
+#endif
+
+void tru_bsp_init(void){
+	#ifdef SEMIHOSTING
+		initialise_monitor_handles();  // Initialise Semihosting
+	#endif
+}
+
+#endif
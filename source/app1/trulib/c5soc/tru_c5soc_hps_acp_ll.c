@@ -0,0 +1,104 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cyclone V SoC HPS ACP (Accelerator Coherency Port) ID Mapper and
+	coherent buffers.
+*/
+
+#include "tru_c5soc_hps_acp_ll.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "tru_iom.h"
+#include <stddef.h>
+
+extern uint32_t __acp_pool_start;   // Reference external symbol name from the linker file
+extern uint32_t __acp_buffer_start; // Reference external symbol name from the linker file
+extern uint32_t __acp_buffer_end;   // Reference external symbol name from the linker file
+
+static uint8_t *acp_next = (uint8_t *)&__acp_pool_start;  // Bump allocator position
+
+static uint32_t acp_map_value(uint32_t mid, uint32_t page, uint32_t user){
+	return ((user << TRU_HPS_ACPIDMAP_USER_POS) & TRU_HPS_ACPIDMAP_USER_MASK) |
+	       ((page << TRU_HPS_ACPIDMAP_PAGE_POS) & TRU_HPS_ACPIDMAP_PAGE_MASK) |
+	       ((mid << TRU_HPS_ACPIDMAP_MID_POS) & TRU_HPS_ACPIDMAP_MID_MASK);
+}
+
+// Maps the reads and writes of a master ID to a fixed virtual ID (2 to 6).  Returns -1 if the virtual ID is not valid or the mapping did not take effect
+int32_t tru_hps_acp_map_fixed(uint32_t vid, uint32_t mid, uint32_t page, uint32_t user){
+	if(vid < TRU_HPS_ACP_VID_MIN || vid > TRU_HPS_ACP_VID_MAX) return -1;
+
+	uint32_t offset = (vid - TRU_HPS_ACP_VID_MIN) * TRU_HPS_ACPIDMAP_STRIDE;
+	uint32_t value = acp_map_value(mid, page, user) | TRU_HPS_ACPIDMAP_FORCE;
+
+	iom_wr32((uint32_t *)(TRU_HPS_ACPIDMAP_VID2RD + offset), value);
+	iom_wr32((uint32_t *)(TRU_HPS_ACPIDMAP_VID2WR + offset), value);
+
+	// The status registers show the mapping in use, it changes when the virtual ID is idle
+	uint32_t mask = TRU_HPS_ACPIDMAP_USER_MASK | TRU_HPS_ACPIDMAP_PAGE_MASK | TRU_HPS_ACPIDMAP_MID_MASK;
+	if((iom_rd32((uint32_t *)(TRU_HPS_ACPIDMAP_VID2RD_S + offset)) & mask) != (value & mask)) return -1;
+	if((iom_rd32((uint32_t *)(TRU_HPS_ACPIDMAP_VID2WR_S + offset)) & mask) != (value & mask)) return -1;
+
+	return 0;
+}
+
+// Sets the page and AxUSER of the reads and writes of the dynamically mapped masters
+void tru_hps_acp_map_dynamic(uint32_t page, uint32_t user){
+	uint32_t value = acp_map_value(0U, page, user);
+
+	iom_wr32((uint32_t *)TRU_HPS_ACPIDMAP_DYNRD, value);
+	iom_wr32((uint32_t *)TRU_HPS_ACPIDMAP_DYNWR, value);
+}
+
+// Maps the dynamic IDs to coherent accesses of the .acp_buffer section.  Returns -1 if the section crosses a 1GB page
+int32_t tru_hps_acp_init(void){
+	uint32_t start = (uint32_t)&__acp_buffer_start;
+	uint32_t end = (uint32_t)&__acp_buffer_end;
+	uint32_t page = start >> 30U;
+
+	if(end > start && ((end - 1U) >> 30U) != page) return -1;
+
+	tru_hps_acp_map_dynamic(page, TRU_HPS_ACP_USER_COHERENT);
+	return 0;
+}
+
+// Allocates a buffer from the .acp_buffer section, align must be a power of 2 (at least 32, the cache line size).  Returns NULL if there is not enough space
+void *tru_hps_acp_alloc(uint32_t size, uint32_t align){
+	if(align < 32U) align = 32U;
+
+	uint32_t end = (uint32_t)&__acp_buffer_end;
+	uint32_t addr = ((uint32_t)acp_next + align - 1U) & ~(align - 1U);
+	if(addr < (uint32_t)acp_next || addr > end || size > end - addr) return NULL;
+
+	acp_next = (uint8_t *)addr + size;
+	return (void *)addr;
+}
+
+// Frees all allocated buffers, the FPGA masters must have stopped using them
+void tru_hps_acp_free_all(void){
+	acp_next = (uint8_t *)&__acp_pool_start;
+}
+
+#endif
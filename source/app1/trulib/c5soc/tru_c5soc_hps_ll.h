@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251223
+	Version: 20261019
 
 	Low-level code for Cyclone V SoC HPS.
 */
@@ -48,11 +48,13 @@
 #define TRU_HPS_L2C310_TAGRAM_LATENCY  0x0U
 #define TRU_HPS_L2C310_DATARAM_LATENCY 0x10U
 
-// Map HPS to Arm defines
-#define TRU_PERIPH_BASE            TRU_HPS_PERI_BASE
-#define TRU_L2C310_BASE            TRU_HPS_L2C310_BASE
-#define TRU_L2C310_TAGRAM_LATENCY  TRU_HPS_L2C310_TAGRAM_LATENCY
-#define TRU_L2C310_DATARAM_LATENCY TRU_HPS_L2C310_DATARAM_LATENCY
+// Map HPS to Arm defines, unless the board has mapped them already (e.g. QEMU vexpress-a9)
+#ifndef TRU_PERIPH_BASE
+	#define TRU_PERIPH_BASE            TRU_HPS_PERI_BASE
+	#define TRU_L2C310_BASE            TRU_HPS_L2C310_BASE
+	#define TRU_L2C310_TAGRAM_LATENCY  TRU_HPS_L2C310_TAGRAM_LATENCY
+	#define TRU_L2C310_DATARAM_LATENCY TRU_HPS_L2C310_DATARAM_LATENCY
+#endif
 
 #endif
 
@@ -21,35 +21,60 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20250218
+	Version: 20261019
 */
 
 #include "tru_c5soc_hps_uart_ll.h"
 
 #if(TRU_TARGET == TRU_TARGET_C5SOC)
 
+// Non-blocking check, true when all pending data has been transmitted
+bool tru_hps_uart_ll_is_empty(void *uart_base){
+	return (tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_TEMT_SET_MSK) != 0U;
+}
+
+// FIFO & threshold mode enabled?
+bool tru_hps_uart_ll_is_fifo_th_en(void *uart_base){
+	return tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_SFE_OFFSET) && tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_STET_OFFSET);
+}
+
+// Non-blocking check, true when the UART controller can accept a byte in its transmit buffer
+bool tru_hps_uart_ll_is_ready(void *uart_base, char fifo_th_en){
+	// Same bit but with the opposite logic depending on the mode set (see tru_hps_uart_ll_wait_ready)
+	if(fifo_th_en){
+		return (tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_THRE_SET_MSK) == 0U;
+	}else{
+		return (tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_THRE_SET_MSK) != 0U;
+	}
+}
+
+// Non-blocking check, true when a received byte is available
+bool tru_hps_uart_ll_is_rx_ready(void *uart_base){
+	return (tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_DR_SET_MSK) != 0U;
+}
+
 /*
 	Blocking wait on the transmit empty register to become empty.  It becomes
 	empty when all pending data in the FIFO (FIFO mode) or holding register
 	(non-FIFO mode) is transmitted.  This ensures all pending data has gone out.
 */
 void tru_hps_uart_ll_wait_empty(void *uart_base){
-	while((TRU_HPS_UART_REG(uart_base)->lsr & TRU_HPS_UART_LSR_TEMT_SET_MSK) == 0U);  // Flush UART and wait
+	while((tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_TEMT_SET_MSK) == 0U);  // Flush UART and wait
 }
 
 void tru_hps_uart_ll_wait_ready(void *uart_base, char fifo_th_en){
 	// Wait until the UART controller is ready to accept a byte in its transmit buffer, i.e. there is free space?
 	// They are masochists - using the same bit but with the opposite logic depending on the mode set!
 	if(fifo_th_en){
-		while(TRU_HPS_UART_REG(uart_base)->lsr & TRU_HPS_UART_LSR_THRE_SET_MSK);  // Wait while not empty. Bit 5 of LSR reg (THRE bit), 1 = not empty, 0 = empty
+		while(tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_THRE_SET_MSK);  // Wait while not empty. Bit 5 of LSR reg (THRE bit), 1 = not empty, 0 = empty
 	}else{
-		while((TRU_HPS_UART_REG(uart_base)->lsr & TRU_HPS_UART_LSR_THRE_SET_MSK) == 0U);  // Wait while not empty. Bit 5 of LSR reg (THRE bit), 0 = not empty, 1 = empty
+		while((tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_LSR_OFFSET) & TRU_HPS_UART_LSR_THRE_SET_MSK) == 0U);  // Wait while not empty. Bit 5 of LSR reg (THRE bit), 0 = not empty, 1 = empty
 	}
 }
 
 void tru_hps_uart_ll_write_str(void *uart_base, const char *str, uint32_t len){
 	// FIFO & threshold mode enabled?
-	char fifo_th_en = (TRU_HPS_UART_REG(uart_base)->sfe && TRU_HPS_UART_REG(uart_base)->stet) ? 1U : 0U;
+	char fifo_th_en = (tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_SFE_OFFSET) && tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_STET_OFFSET)) ? 1U : 0U;
 
 	// Write input bytes to UART controller, one at a time
 	for(uint32_t i = 0U; i < len; i++){
@@ -58,30 +83,30 @@ void tru_hps_uart_ll_write_str(void *uart_base, const char *str, uint32_t len){
 		// For each '\n' character insert '\r'?
 		#if defined(TRU_LOG_RN) && TRU_LOG_RN == 1U
 			if(str[i] == '\n'){
-				TRU_HPS_UART_REG(uart_base)->rbr_thr_dll = '\r';
+				tru_hps_uart_ll_wr(uart_base, TRU_HPS_UART_RBR_THR_DLL_OFFSET, '\r');
 				tru_hps_uart_ll_wait_ready(uart_base, fifo_th_en);
 			}
 		#endif
 
-		TRU_HPS_UART_REG(uart_base)->rbr_thr_dll = str[i];  // Write a single character to UART controller transmit holding register
+		tru_hps_uart_ll_wr(uart_base, TRU_HPS_UART_RBR_THR_DLL_OFFSET, str[i]);  // Write a single character to UART controller transmit holding register
 	}
 }
 
 void tru_hps_uart_ll_write_char(void *uart_base, const char c){
 	// FIFO & threshold mode enabled?
-	char fifo_th_en = (TRU_HPS_UART_REG(uart_base)->sfe && TRU_HPS_UART_REG(uart_base)->stet) ? 1U : 0U;
+	char fifo_th_en = (tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_SFE_OFFSET) && tru_hps_uart_ll_rd(uart_base, TRU_HPS_UART_STET_OFFSET)) ? 1U : 0U;
 
 	tru_hps_uart_ll_wait_ready(uart_base, fifo_th_en);
 
 	// For each '\n' character insert '\r'?
 	#if defined(TRU_LOG_RN) && TRU_LOG_RN == 1U
 		if(c == '\n'){
-			TRU_HPS_UART_REG(uart_base)->rbr_thr_dll = '\r';
+			tru_hps_uart_ll_wr(uart_base, TRU_HPS_UART_RBR_THR_DLL_OFFSET, '\r');
 			tru_hps_uart_ll_wait_ready(uart_base, fifo_th_en);
 		}
 	#endif
 
-	TRU_HPS_UART_REG(uart_base)->rbr_thr_dll = c;  // Write a single character to UART controller transmit holding register
+	tru_hps_uart_ll_wr(uart_base, TRU_HPS_UART_RBR_THR_DLL_OFFSET, c);  // Write a single character to UART controller transmit holding register
 }
 
 void tru_hps_uart_ll_write_hex_nibble(void *uart_base, unsigned char nibble){
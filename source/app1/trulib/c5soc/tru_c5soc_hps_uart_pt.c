@@ -0,0 +1,71 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Non-blocking (protothread) writer for Cyclone V SoC HPS UART controller.
+*/
+
+#include "tru_c5soc_hps_uart_pt.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "tru_c5soc_hps_uart_ll.h"
+
+void tru_hps_uart_pt_write_init(tru_hps_uart_pt_writer_t *w, void *uart_base, const char *str, uint32_t len){
+	TRU_PT_INIT(&w->pt);
+	w->uart_base = uart_base;
+	w->str = str;
+	w->len = len;
+	w->i = 0U;
+	w->fifo_th_en = tru_hps_uart_ll_is_fifo_th_en(uart_base) ? 1U : 0U;
+}
+
+// Writes the string, returns TRU_PT_WAITING while the transmit buffer is full and TRU_PT_ENDED when all bytes are queued
+TRU_PT_THREAD(tru_hps_uart_pt_write(tru_hps_uart_pt_writer_t *w)){
+	TRU_PT_BEGIN(&w->pt);
+
+	for(w->i = 0U; w->i < w->len; w->i++){
+		// For each '\n' character insert '\r'?
+		#if defined(TRU_LOG_RN) && TRU_LOG_RN == 1U
+			if(w->str[w->i] == '\n'){
+				TRU_PT_WAIT_UNTIL(&w->pt, tru_hps_uart_ll_is_ready(w->uart_base, w->fifo_th_en));
+				tru_hps_uart_ll_wr(w->uart_base, TRU_HPS_UART_RBR_THR_DLL_OFFSET, '\r');
+			}
+		#endif
+
+		TRU_PT_WAIT_UNTIL(&w->pt, tru_hps_uart_ll_is_ready(w->uart_base, w->fifo_th_en));
+		tru_hps_uart_ll_wr(w->uart_base, TRU_HPS_UART_RBR_THR_DLL_OFFSET, w->str[w->i]);  // Write a single character to UART controller transmit holding register
+	}
+
+	TRU_PT_END(&w->pt);
+}
+
+// Waits until all pending data has been transmitted
+TRU_PT_THREAD(tru_hps_uart_pt_wait_empty(tru_pt_t *pt, void *uart_base)){
+	TRU_PT_BEGIN(pt);
+	TRU_PT_WAIT_UNTIL(pt, tru_hps_uart_ll_is_empty(uart_base));
+	TRU_PT_END(pt);
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Non-blocking (protothread) writer for Cyclone V SoC HPS UART controller.
+
+	The blocking writer in tru_c5soc_hps_uart_ll.c spins while the transmit
+	buffer is full.  This one returns TRU_PT_WAITING instead, so the caller
+	can service other protothreads and call it again later.
+
+	Example:
+		tru_hps_uart_pt_writer_t w;
+		tru_hps_uart_pt_write_init(&w, (void *)TRU_HPS_UART0_BASE, msg, len);
+		while(TRU_PT_SCHEDULE(tru_hps_uart_pt_write(&w))){
+			// Do other work
+		}
+*/
+
+#ifndef TRU_C5SOC_HPS_UART_PT_H
+#define TRU_C5SOC_HPS_UART_PT_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include "tru_pt.h"
+#include <stdint.h>
+
+typedef struct{
+	tru_pt_t pt;
+	void *uart_base;
+	const char *str;
+	uint32_t len;
+	uint32_t i;
+	char fifo_th_en;
+}tru_hps_uart_pt_writer_t;
+
+void tru_hps_uart_pt_write_init(tru_hps_uart_pt_writer_t *w, void *uart_base, const char *str, uint32_t len);
+TRU_PT_THREAD(tru_hps_uart_pt_write(tru_hps_uart_pt_writer_t *w));
+TRU_PT_THREAD(tru_hps_uart_pt_wait_empty(tru_pt_t *pt, void *uart_base));
+
+#endif
+
+#endif
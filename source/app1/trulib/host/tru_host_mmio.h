@@ -0,0 +1,71 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Simulated memory-mapped registers for the host build.
+
+	With TRU_CPU_FAMILY_HOST, iom_rd32() and iom_wr32() (tru_iom.h) call into
+	here instead of accessing the bus.  A register block is mapped at its
+	target address (e.g. TRU_HPS_UART0_BASE) and is backed by simulated
+	memory, so the drivers run unchanged with their hard-wired addresses.
+	Individual registers can have read and write callbacks to model the
+	hardware behaviour, e.g. a status register or a transmit holding
+	register.
+
+	Accesses outside of the mapped blocks are treated as ordinary memory.
+
+	Only drivers that access their registers through iom_rd32/iom_wr32 can be
+	simulated, code using inline assembly (e.g. arm/tru_cortex_a9.h) is not
+	built for the host.
+*/
+
+#ifndef TRU_HOST_MMIO_H
+#define TRU_HOST_MMIO_H
+
+// No tru_config.h include here, tru_iom.h includes this header while the config is being processed
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef TRU_HOST_MMIO_BLOCKS_MAX
+	#define TRU_HOST_MMIO_BLOCKS_MAX 16U
+#endif
+
+#ifndef TRU_HOST_MMIO_HOOKS_MAX
+	#define TRU_HOST_MMIO_HOOKS_MAX 64U
+#endif
+
+// Read callback, val is the stored register value, returns the value to be read
+typedef uint32_t (*tru_host_mmio_rd_t)(void *ctx, uintptr_t addr, uint32_t val);
+
+// Write callback, called after the value is stored
+typedef void (*tru_host_mmio_wr_t)(void *ctx, uintptr_t addr, uint32_t val);
+
+int32_t tru_host_mmio_map(uintptr_t base, size_t size);
+int32_t tru_host_mmio_hook(uintptr_t addr, tru_host_mmio_rd_t rd, tru_host_mmio_wr_t wr, void *ctx);
+void tru_host_mmio_unmap_all(void);
+uint32_t *tru_host_mmio_ptr(uintptr_t addr);
+uint32_t tru_host_mmio_rd32(uintptr_t addr);
+void tru_host_mmio_wr32(uintptr_t addr, uint32_t val);
+
+#endif
@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251223
+	Version: 20261019
 
 	Memory read write support.
 */
@@ -32,6 +32,10 @@
 #include "tru_config.h"
 #include <stdint.h>
 
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_HOST)
+	#include "host/tru_host_mmio.h"
+#endif
+
 // Divide and align up
 #define DIV_CEIL(_n, _d) (((_n) + (_d) - 1) / (_d))
 
@@ -60,15 +64,26 @@ static inline uint32_t u8_to_u32(uint8_t b3, uint8_t b2, uint8_t b1, uint8_t b0)
 	return (((uint32_t)b3) << 24) | (((uint32_t)b2) << 16) | (((uint32_t)b1) << 8) | b0;
 }
 
-// Static inline function to read a memory-mapped 32-bit register
-static inline uint32_t iom_rd32(uint32_t *src){
-	return *(volatile uint32_t *)src;
-}
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_HOST)
+	// Host build: the registers are simulated
+	static inline uint32_t iom_rd32(uint32_t *src){
+		return tru_host_mmio_rd32((uintptr_t)src);
+	}
 
-// Static inline function to write a memory-mapped 32-bit register
-static inline void iom_wr32(uint32_t *dst, uint32_t num){
-	*(volatile uint32_t *)dst = num;
-}
+	static inline void iom_wr32(uint32_t *dst, uint32_t num){
+		tru_host_mmio_wr32((uintptr_t)dst, num);
+	}
+#else
+	// Static inline function to read a memory-mapped 32-bit register
+	static inline uint32_t iom_rd32(uint32_t *src){
+		return *(volatile uint32_t *)src;
+	}
+
+	// Static inline function to write a memory-mapped 32-bit register
+	static inline void iom_wr32(uint32_t *dst, uint32_t num){
+		*(volatile uint32_t *)dst = num;
+	}
+#endif
 
 static inline void iom_rd32_discard(uint32_t *src){
 	__asm__ volatile ("" : : "r"(*src));  // Read and do nothing with it
@@ -81,7 +96,7 @@ static inline uint8_t tru_rd8_unaligned(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B1(src32[0]);
@@ -107,7 +122,7 @@ static inline void tru_w8_unaligned(void *dst, uint8_t num){
 #else
 	// Restrict to 32-bit access
 	uint32_t *dst32;
-	switch((uint32_t)dst & 0x3){
+	switch((uintptr_t)dst & 0x3){
 		case 1:
 			dst32 = (uint32_t *)((uint8_t *)dst - 1);
 			dst32[0] = (dst32[0] & 0xffff00ff) | num << 8;
@@ -133,7 +148,7 @@ static inline uint32_t tru_rd32_unaligned(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return u8_to_u32(U32_B0(src32[1]), U32_B3(src32[0]), U32_B2(src32[0]), U32_B1(src32[0]));
@@ -162,7 +177,7 @@ static inline void tru_w32_unaligned(void *dst, uint32_t num){
 #else
 	// Restrict to 32-bit access
 	uint32_t *dst32;
-	switch((uint32_t)dst & 0x3){
+	switch((uintptr_t)dst & 0x3){
 		case 1:
 			dst32 = (uint32_t *)((uint8_t *)dst - 1);
 			dst32[0] = (dst32[0] & 0x000000ff) | U32_B2(num) << 24 | U32_B1(num) << 16 | U32_B0(num) << 8;
@@ -191,7 +206,7 @@ static inline uint16_t buf_le_to_u16(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B2(src32[0]) << 8 | U32_B1(src32[0]);
@@ -217,7 +232,7 @@ static inline uint32_t buf_le_to_u24(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B3(src32[0]) << 16 | U32_B2(src32[0]) << 8 | U32_B1(src32[0]);
@@ -243,7 +258,7 @@ static inline uint32_t buf_le_to_u32(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B0(src32[1]) << 24 | U32_B3(src32[0]) << 16 | U32_B2(src32[0]) << 8 | U32_B1(src32[0]);
@@ -269,7 +284,7 @@ static inline uint16_t buf_be_to_u16(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B1(src32[0]) << 8 | U32_B2(src32[0]);
@@ -295,7 +310,7 @@ static inline uint32_t buf_be_to_u24(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B1(src32[0]) << 16 | U32_B2(src32[0]) << 8 | U32_B3(src32[0]);
@@ -321,7 +336,7 @@ static inline uint32_t buf_be_to_u32(void *src){
 #else
 	// Restrict to 32-bit access
 	uint32_t *src32;
-	switch((uint32_t)src & 0x3){
+	switch((uintptr_t)src & 0x3){
 		case 1:
 			src32 = (uint32_t *)((uint8_t *)src - 1);
 			return U32_B1(src32[0]) << 24 | U32_B2(src32[0]) << 16 | U32_B3(src32[0]) << 8 | U32_B0(src32[1]);
@@ -0,0 +1,153 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Protothreads, stackless coroutines for I/O bound code.
+
+	Based on the local continuation idea by Adam Dunkels: the body of a
+	protothread function is wrapped in a switch statement and each wait point
+	stores the current line number as a case label, so the next call of the
+	function resumes from there.  A wait on hardware therefore returns to the
+	caller instead of spinning, and several protothreads can be polled in turn
+	from one loop (or a scheduler task) to overlap their waits.
+
+	Rules:
+		- Local variables are not preserved across a wait or yield, keep state
+		  in a struct passed to the protothread function
+		- Do not use a switch statement inside the body of a protothread
+		- Only one wait or yield per source line, the line number is the label
+		- There is no stack per protothread, each one costs only its state
+
+	Example:
+		TRU_PT_THREAD(blink(tru_pt_t *pt, tru_pt_timer_t *tmr)){
+			TRU_PT_BEGIN(pt);
+			while(1){
+				led_toggle();
+				TRU_PT_WAIT_TICKS(pt, tmr, 100000000U);
+			}
+			TRU_PT_END(pt);
+		}
+*/
+
+#ifndef TRU_PT_H
+#define TRU_PT_H
+
+#include "tru_config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Protothread return status
+#define TRU_PT_WAITING 0
+#define TRU_PT_YIELDED 1
+#define TRU_PT_EXITED  2
+#define TRU_PT_ENDED   3
+
+// Protothread state (local continuation)
+typedef struct{
+	uint32_t lc;
+}tru_pt_t;
+
+#define TRU_PT_INIT(pt) ((pt)->lc = 0U)
+
+// Declares a protothread function
+#define TRU_PT_THREAD(name_args) char name_args
+
+#define TRU_PT_BEGIN(pt) { char pt_yield_flag = 1; (void)pt_yield_flag; switch((pt)->lc){ case 0:
+
+#define TRU_PT_END(pt) } pt_yield_flag = 0; TRU_PT_INIT(pt); return TRU_PT_ENDED; }
+
+// Returns to the caller until the condition is true
+#define TRU_PT_WAIT_UNTIL(pt, cond) \
+	do{ \
+		(pt)->lc = __LINE__; case __LINE__: \
+		if(!(cond)) return TRU_PT_WAITING; \
+	}while(0)
+
+#define TRU_PT_WAIT_WHILE(pt, cond) TRU_PT_WAIT_UNTIL((pt), !(cond))
+
+// Returns to the caller once, unconditionally
+#define TRU_PT_YIELD(pt) \
+	do{ \
+		pt_yield_flag = 0; \
+		(pt)->lc = __LINE__; case __LINE__: \
+		if(pt_yield_flag == 0) return TRU_PT_YIELDED; \
+	}while(0)
+
+#define TRU_PT_EXIT(pt) \
+	do{ \
+		TRU_PT_INIT(pt); \
+		return TRU_PT_EXITED; \
+	}while(0)
+
+#define TRU_PT_RESTART(pt) \
+	do{ \
+		TRU_PT_INIT(pt); \
+		return TRU_PT_WAITING; \
+	}while(0)
+
+// Is the protothread still running?  Use with the return value of a protothread function
+#define TRU_PT_SCHEDULE(f) ((f) < TRU_PT_EXITED)
+
+// Waits until a child protothread has finished
+#define TRU_PT_WAIT_THREAD(pt, thread) TRU_PT_WAIT_WHILE((pt), TRU_PT_SCHEDULE(thread))
+
+// Starts a child protothread and waits until it has finished
+#define TRU_PT_SPAWN(pt, child, thread) \
+	do{ \
+		TRU_PT_INIT(child); \
+		TRU_PT_WAIT_THREAD((pt), (thread)); \
+	}while(0)
+
+// ===========
+// Timer waits
+// ===========
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "arm/tru_cortex_a9.h"
+
+typedef struct{
+	uint64_t expiry;  // Global timer ticks
+}tru_pt_timer_t;
+
+static inline void tru_pt_timer_set(tru_pt_timer_t *timer, uint64_t ticks){
+	if(!gtim_is_enabled()) gtim_enable();
+	timer->expiry = gtim_get_counter() + ticks;
+}
+
+static inline bool tru_pt_timer_expired(const tru_pt_timer_t *timer){
+	return gtim_get_counter() >= timer->expiry;
+}
+
+// Returns to the caller until the number of global timer ticks has passed
+#define TRU_PT_WAIT_TICKS(pt, timer, ticks) \
+	do{ \
+		tru_pt_timer_set((timer), (ticks)); \
+		TRU_PT_WAIT_UNTIL((pt), tru_pt_timer_expired(timer)); \
+	}while(0)
+
+#endif
+
+#endif
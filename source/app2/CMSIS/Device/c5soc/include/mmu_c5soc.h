@@ -82,6 +82,13 @@ static inline void MMU_InvalidateRange(uint32_t *ttb, uint32_t base_address, uin
 	}
 }
 
+#if defined(TRU_MMU) && TRU_MMU == 1U
+	void mmu_create_noncache_table_entries(uint32_t base, uint32_t size);
+	void mmu_create_device_table_entries(uint32_t base, uint32_t size);
+	void mmu_create_normal_table_entries(uint32_t base, uint32_t size);
+	void mmu_create_amp_shared_table_entries(void);
+#endif
+
 #if defined(TRU_DMA_BUFFER_NONCACHEABLE) && TRU_DMA_BUFFER_NONCACHEABLE == 1U && defined(TRU_MMU) && TRU_MMU == 1U
 	void mmu_create_dma_buffer_table_entries(void);
 #endif
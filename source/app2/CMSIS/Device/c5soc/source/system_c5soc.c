@@ -29,8 +29,11 @@
 #include "RTE_Components.h"
 #include CMSIS_device_header
 #include "irq_ctrl.h"
+#include "c5soc/tru_c5soc_hps_clkmgr_ll.h"
+#include "arm/tru_boot_prof.h"
+#include "arm/tru_cache_l2c310.h"
 
-#define SYSTEM_CLOCK 800000000UL
+#define SYSTEM_CLOCK 800000000UL  // Default until SystemCoreClockUpdate() is called, usual U-Boot (handoff) setting for DE10-Nano
 
 /*----------------------------------------------------------------------------
   System Core Clock Variable
@@ -41,7 +44,13 @@ uint32_t SystemCoreClock = SYSTEM_CLOCK;
   System Core Clock update function
  *----------------------------------------------------------------------------*/
 void SystemCoreClockUpdate(){
-  SystemCoreClock = SYSTEM_CLOCK;
+#if defined(TRU_CPU_CLK_HZ)
+  // Fixed by the board, which has no clock manager
+  SystemCoreClock = TRU_CPU_CLK_HZ;
+#else
+  // Read the MPU clock from the clock manager main PLL settings (set up by U-Boot or the preloader)
+  SystemCoreClock = (uint32_t)get_mpu_base_clk(TRU_HPS_INPUT_CLK_HZ).fout;
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -74,31 +83,49 @@ void SystemInit(){
 #if defined(TRU_NEON) && TRU_NEON == 1U && __FPU_PRESENT == 1U && __FPU_USED == 1U
   __FPU_Enable();
 #endif
+  TRU_BOOT_PROF_MARK(TRU_BOOT_PHASE_INVALIDATE);
 
 #if defined(TRU_MMU) && TRU_MMU == 1U
   MMU_CreateTranslationTable();
 #if defined(TRU_DMA_BUFFER_NONCACHEABLE) && TRU_DMA_BUFFER_NONCACHEABLE == 1U
   mmu_create_dma_buffer_table_entries();
 #endif
+  mmu_create_amp_shared_table_entries();
   MMU_Enable();
 #endif
+  TRU_BOOT_PROF_MARK(TRU_BOOT_PHASE_MMU);
 
 #if defined(TRU_L1_CACHE) && TRU_L1_CACHE == 1U
   // Enable L1 caches
   L1C_EnableCaches();
   L1C_EnableBTAC();
 #endif
+  TRU_BOOT_PROF_MARK(TRU_BOOT_PHASE_L1_ENABLE);
 
 #if defined(TRU_L2_CACHE) && TRU_L2_CACHE == 1U && __L2C_PRESENT == 1U
   //L2C_310->AUX_CNT = L2C_310->AUX_CNT & ~(1U << 29U | 1U << 28U);  // Disable L2 instruction and data prefetch
   //L2C_310->AUX_CNT = L2C_310->AUX_CNT & ~(1U << 21U);  // Disable L2 parity
 
+  L2C_310->CONTROL = 0U;  // The latency and auxiliary control registers can only be written while disabled, L2C_Enable() disables it first anyway
+
   // Set data RAM latency
-  __IOM uint32_t *L2C_310_REG1_DATA_RAM_CNT = (__IOM uint32_t *)L2C_310_BASE + 0x10cU;
-  *L2C_310_REG1_DATA_RAM_CNT = (*L2C_310_REG1_DATA_RAM_CNT & ~0x777U) | 0x10U;  // Read access set to 2 cycles of latency (value taken from Intel/Altera HWLib)
+  __IOM uint32_t *L2C_310_REG1_DATA_RAM_CNT = (__IOM uint32_t *)(L2C_310_BASE + TRU_L2C310_DATARAM_OFFSET);
+  *L2C_310_REG1_DATA_RAM_CNT = (*L2C_310_REG1_DATA_RAM_CNT & ~0x777U) | TRU_L2C310_DATARAM_LATENCY;  // Read access set to 2 cycles of latency on the Cyclone V (value taken from Intel/Altera HWLib)
+
+#if defined(TRU_L2_EARLY_BRESP) && TRU_L2_EARLY_BRESP == 1U
+  L2C_310->AUX_CNT |= TRU_L2C310_AUX_EARLY_BRESP;  // Write responses before the slave has accepted the data
+#endif
 
   L2C_Enable();
 #endif
+#if defined(TRU_L2_WAYS) && TRU_L2_WAYS != 0U && __L2C_PRESENT == 1U
+  tru_l2c310_init_ways();  // Partition the L2 cache between the cores (lockdown by master)
+#endif
+#if defined(TRU_L2_PREFETCH) && TRU_L2_PREFETCH != 0U && __L2C_PRESENT == 1U
+  tru_l2c310_init_prefetch();
+#endif
+  TRU_BOOT_PROF_MARK(TRU_BOOT_PHASE_L2_ENABLE);
 
   IRQ_Initialize();  // Initialise the IRQ system, e.g. user interrupt handler table and GIC system
+  TRU_BOOT_PROF_MARK(TRU_BOOT_PHASE_IRQ_INIT);
 }
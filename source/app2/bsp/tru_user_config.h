@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251205
+	Version: 20261019
 
 	Trulib user configuration
 */
@@ -49,5 +49,21 @@
 #define TRU_CFG_LOG_LOC                 0U
 #define TRU_CFG_DMA_BUFFER_NONCACHEABLE 1U
 #define TRU_CFG_CLEAN_CACHE             0U
+#define TRU_CFG_STACK_PAINT             1U
+#define TRU_CFG_IDLE_HOT_TICKS          0U  // Idle busy-poll window in global timer ticks before entering WFI, 0 = enter WFI straight away
+#define TRU_CFG_TIMER_MAX               64U
+#define TRU_CFG_PROF                    0U  // 1 = enable sampling profiler support in IRQ_Handler
+#define TRU_CFG_IRQ_STATS               0U  // 1 = enable per-IRQ statistics and entry time stamp in IRQ_Handler
+#define TRU_CFG_BENCH_PMU               0U  // 1 = time the benchmarks with the PMU cycle counter instead of the global timer (not on QEMU)
+#define TRU_CFG_BENCH_L2_EVENTS         0U  // 1 = count the L2 data reads and hits of the benchmarks with the L2 cache controller event counters
+#define TRU_CFG_BOOT_PROF               0U  // Set to 1 in both apps to time stamp each startup phase, printed by app1
+#define TRU_CFG_AMP_LOAD                0U  // Set to 1 in app2 to serve the load generator requests of app1 after its hello message
+#define TRU_CFG_CACHE_L2_WAY_OPS        0U  // 1 = allows the size-adaptive cache functions to clean the whole shared L2 cache by way, with IRQs masked for the whole operation
+#define TRU_CFG_L2_WAYS                 0U  // Bit mask of the L2 ways this core can allocate into (lockdown by master), e.g. 0x0fU in app1 and 0xf0U in app2, 0 = no change, app1 applies it again after core 1 has started (app2 L2 cache setup clears it)
+#define TRU_CFG_L2_PREFETCH             0U  // L2 prefetch control register value, e.g. TRU_L2C310_PF_PRESET_STREAM (see arm/tru_cache_l2c310.h), 0 = no change
+#define TRU_CFG_L2_EARLY_BRESP          0U  // 1 = enable early write response of the L2 cache (only when this app enables the L2 cache)
+#define TRU_CFG_L2_PIN_FAST             0U  // 1 = pin the .fast section (TRU_FASTCODE, TRU_FASTDATA) into the L2 cache at boot, app1 only
+#define TRU_CFG_MEM_PLD_DIST            192U  // PLD distance in bytes of the trulib memcpy (arm/tru_mem.h), see the MEMCPY line of the benchmarks
+#define TRU_CFG_MEM_OVERRIDE            0U  // 1 = replace the newlib memcpy, memmove and memset with the trulib NEON versions (needs TRU_CFG_NEON = 1U)
 
 #endif
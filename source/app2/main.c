@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251205
+	Version: 20261019
 	Program: Hello, World! AMP for core 1
 	Target : ARM Cortex-A9 on the DE10-Nano Kit development board (Altera
 	         Cyclone V SoC FPGA)
@@ -53,6 +53,11 @@
 // Trulib includes
 #include "tru_config.h"
 #include "arm/tru_cortex_a9.h"
+#include "arm/tru_stack.h"
+#include "arm/tru_time.h"
+#include "arm/tru_trace.h"
+#include "arm/tru_amp_load.h"
+#include "arm/tru_amp_shared.h"
 
 // Arm CMSIS includes
 #include "RTE_Components.h"   // CMSIS
@@ -60,11 +65,16 @@
 
 // Standard includes
 #include <stdio.h>
+#include <stdlib.h>
 
 #ifdef SEMIHOSTING
 	extern void initialise_monitor_handles(void);  // Reference function header from the external Semihosting library
 #endif
 
+#if defined(TRU_AMP_LOAD) && TRU_AMP_LOAD == 1U
+	#define TRU_AMP_LOAD_BUF_SIZE (8U * 1024U * 1024U)  // Work area of the memory loads, larger than the L2 cache
+#endif
+
 void tx_hello(void){
 	uint32_t mpidr;
 	__read_mpidr(mpidr);  // Read MPIDR register to get current processor number
@@ -79,8 +89,27 @@ int main(int argc, char **argv){
 		initialise_monitor_handles();  // Initialise Semihosting
 	#endif
 
+	tru_time_init(0U);  // Calibrate the time base from the clock manager
+#if defined(TRU_TRACE) && TRU_TRACE == 1U
+	tru_trace_start();  // Start logging function entries and exits (fi=1 build option)
+#endif
+
 	tx_hello();
+#if defined(TRU_STACK_PAINT) && TRU_STACK_PAINT == 1U
+	tru_stack_print_report();  // Report high-water marks of the processor mode stacks of core 1
+#endif
 	tru_hps_uart_ll_wait_empty((void *)TRU_HPS_UART0_BASE);  // Wait for messages to empty out of UART
+	tru_amp_set_started();  // Then app1 can output its messages
+#if defined(TRU_TRACE) && TRU_TRACE == 1U
+	tru_trace_dump_amp(120000000U);  // Waits up to 2 minutes for app1 to print its ring (up to 30 s per core) and request this one
+#endif
+
+#if defined(TRU_AMP_LOAD) && TRU_AMP_LOAD == 1U
+	// Run loads requested by app1, e.g. for the memory benchmarks
+	void *load_buf = malloc(TRU_AMP_LOAD_BUF_SIZE);
+	tru_amp_load_serve(load_buf, load_buf ? TRU_AMP_LOAD_BUF_SIZE : 0U);
+	free(load_buf);
+#endif
 
 	return 0;
 }
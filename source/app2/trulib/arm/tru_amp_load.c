@@ -0,0 +1,171 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Load generator for the other core of an AMP system.
+*/
+
+#include "tru_amp_load.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_amp_shared.h"
+#include "tru_cortex_a9.h"
+#include "tru_cache_l2c310.h"
+#include "tru_time.h"
+#include "tru_irq_stats.h"
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <string.h>
+
+#define LOAD_CTRL (&tru_amp_shared.load)
+
+#if(TRU_AMP_LOAD_SGI_ID == TRU_IRQ_LATENCY_SGI_ID)
+	#error "TRU_AMP_LOAD_SGI_ID and TRU_IRQ_LATENCY_SGI_ID must differ"
+#endif
+
+// ================
+// Controlling core
+// ================
+
+// Clears the shared state, call before releasing the other core (the shared memory is not initialised at reset)
+void tru_amp_load_init(void){
+	LOAD_CTRL->ready = 0U;
+	LOAD_CTRL->mode = TRU_AMP_LOAD_IDLE;
+	LOAD_CTRL->arg = 0U;
+	LOAD_CTRL->ack = TRU_AMP_LOAD_IDLE;
+	LOAD_CTRL->iters = 0U;
+	__dmb();
+}
+
+// Waits until the other core is serving, returns false on timeout
+bool tru_amp_load_is_ready(uint32_t timeout_us){
+	uint64_t end = tru_time_us() + timeout_us;
+
+	while(LOAD_CTRL->ready != TRU_AMP_LOAD_READY_MAGIC){
+		if(tru_time_us() >= end) return false;
+	}
+	return true;
+}
+
+// Selects the load and waits until the other core has switched to it.  Returns -1 on timeout
+int32_t tru_amp_load_set(tru_amp_load_mode_t mode, uint32_t arg, uint32_t timeout_us){
+	uint64_t end = tru_time_us() + timeout_us;
+
+	LOAD_CTRL->arg = arg;
+	__dmb();  // Ensure the argument is visible before the mode
+	LOAD_CTRL->mode = mode;
+	__dsb();  // Ensure the write is visible before the event
+	__sev();  // Wake up the other core if it is idle
+
+	while(LOAD_CTRL->ack != mode){
+		if(tru_time_us() >= end) return -1;
+	}
+	return 0;
+}
+
+// ============
+// Serving core
+// ============
+
+static void load_ddr_stream(uint8_t *buf, uint32_t size){
+	uint32_t half = size / 2U;
+
+	for(uint32_t offset = 0U; offset + TRU_AMP_LOAD_CHUNK_SIZE <= half; offset += TRU_AMP_LOAD_CHUNK_SIZE){
+		memcpy(&buf[half + offset], &buf[offset], TRU_AMP_LOAD_CHUNK_SIZE);
+		LOAD_CTRL->iters++;
+		if(LOAD_CTRL->mode != TRU_AMP_LOAD_DDR_STREAM) return;
+	}
+}
+
+static void load_cache_thrash(uint8_t *buf, uint32_t size){
+	for(uint32_t offset = 0U; offset + TRU_AMP_LOAD_CHUNK_SIZE <= size; offset += TRU_AMP_LOAD_CHUNK_SIZE){
+		for(uint32_t line = 0U; line < TRU_AMP_LOAD_CHUNK_SIZE; line += TRU_L2C310_CACHELINE_SIZE){
+			(*(volatile uint32_t *)&buf[offset + line])++;
+		}
+		LOAD_CTRL->iters++;
+		if(LOAD_CTRL->mode != TRU_AMP_LOAD_CACHE_THRASH) return;
+	}
+}
+
+static void sgi_irq_handler(void){
+}
+
+static void load_irq_storm(void){
+	uint32_t targets = LOAD_CTRL->arg;
+
+	for(uint32_t i = 0U; i < TRU_AMP_LOAD_SGI_BURST; i++){
+		if(targets){
+			GIC_SendSGI((IRQn_Type)TRU_AMP_LOAD_SGI_ID, targets, 0U);  // Filter 0: to the target list
+		}else{
+			GIC_SendSGI((IRQn_Type)TRU_AMP_LOAD_SGI_ID, 0U, 2U);  // Filter 2: to the requesting core only
+		}
+	}
+	LOAD_CTRL->iters++;
+}
+
+// Runs the requested loads until TRU_AMP_LOAD_EXIT.  buf is the work area of the memory loads
+void tru_amp_load_serve(void *buf, uint32_t size){
+	IRQHandler_t prev_handler = IRQ_GetHandler(TRU_AMP_LOAD_SGI_ID);
+
+	IRQ_SetHandler(TRU_AMP_LOAD_SGI_ID, sgi_irq_handler);  // For the IRQ storm sent to itself
+	IRQ_Enable(TRU_AMP_LOAD_SGI_ID);
+	LOAD_CTRL->ready = TRU_AMP_LOAD_READY_MAGIC;
+
+	while(1){
+		uint32_t mode = LOAD_CTRL->mode;
+		if(LOAD_CTRL->ack != mode) LOAD_CTRL->ack = mode;
+
+		switch(mode){
+			case TRU_AMP_LOAD_DDR_STREAM:
+				if(buf && size >= 2U * TRU_AMP_LOAD_CHUNK_SIZE){
+					load_ddr_stream(buf, size);
+				}else{
+					__wfe();
+				}
+				break;
+			case TRU_AMP_LOAD_CACHE_THRASH:
+				if(buf && size >= TRU_AMP_LOAD_CHUNK_SIZE){
+					load_cache_thrash(buf, size);
+				}else{
+					__wfe();
+				}
+				break;
+			case TRU_AMP_LOAD_IRQ_STORM:
+				load_irq_storm();
+				break;
+			case TRU_AMP_LOAD_EXIT:
+				LOAD_CTRL->ready = 0U;
+				IRQ_SetHandler(TRU_AMP_LOAD_SGI_ID, prev_handler);
+				return;
+			default:
+				__wfe();  // Idle until the next SEV
+				break;
+		}
+	}
+}
+
+#endif
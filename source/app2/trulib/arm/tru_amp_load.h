@@ -0,0 +1,93 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Load generator for the other core of an AMP system, to measure the effect
+	of a busy core on benchmarks.
+
+	The controlling core (app1) calls tru_amp_load_init() before releasing the
+	other core, and later selects a load with tru_amp_load_set().  The other
+	core (app2) calls tru_amp_load_serve(), which runs the selected load until
+	TRU_AMP_LOAD_EXIT.  The commands are passed through the shared memory
+	(see tru_amp_shared.h), with SEV to wake up an idle core.
+
+	The loads:
+		IDLE        : waits in WFE
+		DDR_STREAM  : copies between the halves of the buffer, which should be larger than the L2 cache
+		CACHE_THRASH: dirties one word of every cache line of the buffer, to evict the lines of the
+		              other core from the shared L2 cache and keep the write-backs busy
+		IRQ_STORM   : sends software generated interrupts (SGI TRU_AMP_LOAD_SGI_ID) back to back,
+		              to the cores in the argument bit mask, or to itself if the argument is 0.  A core
+		              receiving them must have a handler registered for the SGI
+*/
+
+#ifndef TRU_AMP_LOAD_H
+#define TRU_AMP_LOAD_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRU_AMP_LOAD_READY_MAGIC 0x44414f4cU  // "LOAD"
+
+// Size of the work between checks for a new command
+#define TRU_AMP_LOAD_CHUNK_SIZE 65536U
+
+// SGI sent by the IRQ storm load, must differ from TRU_IRQ_LATENCY_SGI_ID (tru_irq_stats.h) so a storm does not fire the latency handler
+#ifndef TRU_AMP_LOAD_SGI_ID
+	#define TRU_AMP_LOAD_SGI_ID 14U
+#endif
+
+// Number of SGIs sent between checks for a new command
+#define TRU_AMP_LOAD_SGI_BURST 64U
+
+typedef enum{
+	TRU_AMP_LOAD_IDLE = 0,
+	TRU_AMP_LOAD_DDR_STREAM,
+	TRU_AMP_LOAD_CACHE_THRASH,
+	TRU_AMP_LOAD_IRQ_STORM,
+	TRU_AMP_LOAD_EXIT,
+	TRU_AMP_LOAD_MODE_COUNT
+}tru_amp_load_mode_t;
+
+// Commands and status, a member of tru_amp_shared_t
+typedef struct{
+	volatile uint32_t ready;  // TRU_AMP_LOAD_READY_MAGIC while tru_amp_load_serve() is running
+	volatile uint32_t mode;   // Requested load, written by the controlling core
+	volatile uint32_t arg;    // Argument of the requested load, written by the controlling core before mode
+	volatile uint32_t ack;    // Running load, written by the serving core
+	volatile uint32_t iters;  // Completed chunks of work, to check progress
+}tru_amp_load_ctrl_t;
+
+void tru_amp_load_init(void);
+bool tru_amp_load_is_ready(uint32_t timeout_us);
+int32_t tru_amp_load_set(tru_amp_load_mode_t mode, uint32_t arg, uint32_t timeout_us);
+void tru_amp_load_serve(void *buf, uint32_t size);
+
+#endif
+
+#endif
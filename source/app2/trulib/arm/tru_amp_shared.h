@@ -0,0 +1,121 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Memory shared between the AMP applications of both cores.
+
+	The linker scripts of both applications place the .amp_shared section at
+	the same address, straight after the core 0 program (__CORE0_RAM_BASE +
+	__CORE0_RAM_SIZE).  The section is not loaded or zeroed by the startup
+	code, and is mapped as normal non-cacheable memory by the MMU setup
+	(mmu_c5soc.c), so it can be read and written by both cores without cache
+	maintenance.
+
+	Both applications are built from the same trulib, so they see the same
+	layout.  New members should be added to the end.
+
+	The memory is not cleared by a reset, so the controlling core (app1)
+	initialises the members it uses before releasing the other core.
+
+	The startup messages of both cores go to the same UART.  The controlling
+	core clears the startup handshake with tru_amp_started_init() before
+	releasing the other core, and waits with tru_amp_wait_started() until the
+	other core has emptied its messages out of the UART and called
+	tru_amp_set_started().
+
+	tru_amp_lock() is a lock between the two cores of the Cyclone V, using
+	Peterson's algorithm with plain loads and stores.  The exclusive access
+	instructions (LDREX/STREX) are not used, because on non-cacheable memory
+	they rely on a global exclusive monitor outside of the processor.  IRQs
+	are masked while the lock is held, so an ISR on the same core cannot
+	deadlock on it.
+*/
+
+#ifndef TRU_AMP_SHARED_H
+#define TRU_AMP_SHARED_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_boot_prof.h"
+#include "tru_amp_load.h"
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+
+// Maximum number of cores of the Cortex-A9 MPCore, indexed with the CPU ID from MPIDR
+#define TRU_AMP_CPU_MAX 4U
+
+typedef struct{
+	volatile uint32_t want[2];  // Indexed with the CPU ID, set while the core wants or holds the lock
+	volatile uint32_t turn;     // CPU ID of the core that waits when both want the lock
+}tru_amp_lock_t;
+
+typedef struct{
+	tru_boot_log_t boot_log[TRU_AMP_CPU_MAX];  // Boot time profiler log of each core (see tru_boot_prof.h)
+	tru_amp_load_ctrl_t load;                  // Load generator commands (see tru_amp_load.h)
+	volatile uint32_t trace_state[TRU_AMP_CPU_MAX];  // Function tracer dump handshake of each core (see tru_trace.h)
+	tru_amp_lock_t l2_lock;                    // L2 cache maintenance lock (see tru_cache.h)
+	volatile uint32_t started[TRU_AMP_CPU_MAX];  // Startup handshake of each core, non-zero once its startup messages are out
+}tru_amp_shared_t;
+
+extern tru_amp_shared_t tru_amp_shared;
+
+void tru_amp_started_init(void);
+void tru_amp_set_started(void);
+int32_t tru_amp_wait_started(uint32_t cpu, uint32_t timeout_us);
+void tru_amp_lock_init(tru_amp_lock_t *lock);
+
+// Masks IRQs and waits for the lock, returns the previous CPSR value for tru_amp_unlock()
+static inline uint32_t tru_amp_lock(tru_amp_lock_t *lock){
+	uint32_t cpsr = tru_irq_save();
+	uint32_t mpidr;
+	__read_mpidr(mpidr);
+	uint32_t self = mpidr & 0x1U;
+	uint32_t other = self ^ 0x1U;
+
+	lock->want[self] = 1U;
+	__dmb();  // The stores must be observed in order, and before the loads below
+	lock->turn = other;
+	__dmb();
+	while(lock->want[other] && lock->turn == other);
+	__dmb();  // Accesses of the critical section after acquiring
+
+	return cpsr;
+}
+
+// Releases the lock and restores the IRQ mask
+static inline void tru_amp_unlock(tru_amp_lock_t *lock, uint32_t cpsr){
+	uint32_t mpidr;
+	__read_mpidr(mpidr);
+
+	__dmb();  // Accesses of the critical section before releasing
+	lock->want[mpidr & 0x1U] = 0U;
+	__dmb();
+	tru_irq_restore(cpsr);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,177 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Microbenchmark harness for Arm Cortex-A9.
+*/
+
+#include "tru_bench.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include "tru_time.h"
+#if defined(TRU_BENCH_L2_EVENTS) && TRU_BENCH_L2_EVENTS == 1U
+	#include "tru_cache_l2c310.h"
+#endif
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stddef.h>
+
+static const tru_bench_t *benches[TRU_BENCH_MAX];
+static uint32_t num_benches;
+static uint32_t samples[TRU_BENCH_RUNS_MAX];
+static uint32_t overhead;
+static uint32_t overhead_valid;
+
+uint32_t tru_bench_hz(void){
+#if defined(TRU_BENCH_PMU) && TRU_BENCH_PMU == 1U
+	return SystemCoreClock;
+#else
+	return tru_time_base.hz;
+#endif
+}
+
+static void bench_empty(void *arg){
+	(void)arg;
+	__asm__ volatile("" ::: "memory");
+}
+
+static uint32_t bench_time(tru_bench_func_t func, void *arg){
+	uint32_t cpsr = tru_irq_save();
+	uint32_t start = tru_bench_now();
+	func(arg);
+	uint32_t ticks = tru_bench_now() - start;
+	tru_irq_restore(cpsr);
+	return ticks;
+}
+
+// The smallest time of calling an empty function, subtracted from every sample
+static void bench_calibrate(void){
+	uint32_t min = UINT32_MAX;
+
+	if(!gtim_is_enabled()) gtim_enable();
+#if defined(TRU_BENCH_PMU) && TRU_BENCH_PMU == 1U
+	tru_pmu_init();  // The cycle counter is stopped from reset
+#endif
+
+	for(uint32_t i = 0U; i < TRU_BENCH_RUNS_MAX; i++){
+		uint32_t ticks = bench_time(bench_empty, NULL);
+		if(ticks < min) min = ticks;
+	}
+
+	overhead = min;
+	overhead_valid = 1U;
+}
+
+// The call overhead subtracted from every sample, measured on the first use
+uint32_t tru_bench_overhead(void){
+	if(!overhead_valid) bench_calibrate();
+	return overhead;
+}
+
+// Insertion sort, the number of samples is small
+static void sort_samples(uint32_t n){
+	for(uint32_t i = 1U; i < n; i++){
+		uint32_t val = samples[i];
+		uint32_t j = i;
+		while(j > 0U && samples[j - 1U] > val){
+			samples[j] = samples[j - 1U];
+			j--;
+		}
+		samples[j] = val;
+	}
+}
+
+// Returns -1 if the registry is full
+int32_t tru_bench_register(const tru_bench_t *bench){
+	if(num_benches >= TRU_BENCH_MAX) return -1;
+
+	benches[num_benches++] = bench;
+	return 0;
+}
+
+void tru_bench_run(const tru_bench_t *bench, uint32_t warmup, uint32_t runs, tru_bench_result_t *result){
+	if(!overhead_valid) bench_calibrate();
+	if(runs == 0U) runs = 1U;
+	if(runs > TRU_BENCH_RUNS_MAX) runs = TRU_BENCH_RUNS_MAX;
+
+	for(uint32_t i = 0U; i < warmup; i++){
+		bench->func(bench->arg);
+	}
+
+	result->runs = runs;
+	result->total = 0U;
+	result->l2_rd = 0U;
+	result->l2_rd_hit = 0U;
+#if defined(TRU_BENCH_L2_EVENTS) && TRU_BENCH_L2_EVENTS == 1U
+	tru_l2c310_ev_start(TRU_L2C310_EV_DRREQ, TRU_L2C310_EV_DRHIT);
+#endif
+	for(uint32_t i = 0U; i < runs; i++){
+		uint32_t ticks = bench_time(bench->func, bench->arg);
+		ticks = (ticks > overhead) ? ticks - overhead : 0U;
+		samples[i] = ticks;
+		result->total += ticks;
+	}
+#if defined(TRU_BENCH_L2_EVENTS) && TRU_BENCH_L2_EVENTS == 1U
+	tru_l2c310_ev_stop();
+	tru_l2c310_ev_read(&result->l2_rd, &result->l2_rd_hit);
+#endif
+
+	sort_samples(runs);
+	result->min = samples[0];
+	result->median = samples[runs / 2U];
+	result->max = samples[runs - 1U];
+}
+
+void tru_bench_print(const tru_bench_t *bench, const tru_bench_result_t *result){
+	printf("BENCH %s unit=%s hz=%" PRIu32 " runs=%" PRIu32 " min=%" PRIu32 " med=%" PRIu32 " avg=%" PRIu32 " max=%" PRIu32, bench->name, TRU_BENCH_UNIT, tru_bench_hz(), result->runs, result->min, result->median, (uint32_t)(result->total / result->runs), result->max);
+	if(bench->bytes && result->min){
+		// Best case throughput in MB/s (10^6 bytes)
+		printf(" mbps=%" PRIu32, (uint32_t)((uint64_t)bench->bytes * tru_bench_hz() / result->min / 1000000U));
+	}
+#if defined(TRU_BENCH_L2_EVENTS) && TRU_BENCH_L2_EVENTS == 1U
+	printf(" l2_rd=%" PRIu32 " l2_rd_hit_pct=%" PRIu32, result->l2_rd / result->runs, result->l2_rd ? (uint32_t)((uint64_t)result->l2_rd_hit * 100U / result->l2_rd) : 0U);
+#endif
+	printf("\n");
+}
+
+void tru_bench_run_all(uint32_t warmup, uint32_t runs){
+	tru_bench_result_t result;
+
+	if(!overhead_valid) bench_calibrate();
+
+	printf("BENCH BEGIN count=%" PRIu32 " overhead=%" PRIu32 "\n", num_benches, overhead);
+	for(uint32_t i = 0U; i < num_benches; i++){
+		tru_bench_run(benches[i], warmup, runs, &result);
+		tru_bench_print(benches[i], &result);
+	}
+	printf("BENCH END\n");
+}
+
+#endif
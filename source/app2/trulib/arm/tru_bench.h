@@ -0,0 +1,110 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Microbenchmark harness for Arm Cortex-A9.
+
+	Benchmarks are registered by name and run a number of times after a
+	warmup (to load the caches and branch predictor).  Each call is timed
+	separately with IRQs masked, and the call overhead of the harness is
+	measured once and subtracted.
+
+	The time unit is the global timer tick by default, which also runs on
+	QEMU.  With TRU_BENCH_PMU = 1U the PMU cycle counter is used instead,
+	the harness enables it with tru_pmu_init() before the first run.
+
+	Results are printed as one machine-parseable line per benchmark:
+		BENCH <name> unit=<ticks|cycles> hz=<hz> runs=<n> min=<t> med=<t> avg=<t> max=<t> [mbps=<n>] [l2_rd=<n> l2_rd_hit_pct=<n>]
+	The L2 fields are added with TRU_BENCH_L2_EVENTS = 1U: the L2 data read
+	requests per run and the percentage of them that hit, counted by the L2
+	cache controller over the timed runs (including the other core).
+	The results can be compared against a baseline on the host with:
+		scripts-py/bench_compare.py <baseline log> <log>
+*/
+
+#ifndef TRU_BENCH_H
+#define TRU_BENCH_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+
+#if defined(TRU_BENCH_PMU) && TRU_BENCH_PMU == 1U
+	#include "tru_pmu.h"
+	#define TRU_BENCH_UNIT "cycles"
+#else
+	#include "tru_cortex_a9.h"
+	#define TRU_BENCH_UNIT "ticks"
+#endif
+
+// Maximum number of registered benchmarks
+#ifndef TRU_BENCH_MAX
+	#define TRU_BENCH_MAX 32U
+#endif
+
+// Maximum number of timed runs per benchmark, all samples are kept for the median
+#ifndef TRU_BENCH_RUNS_MAX
+	#define TRU_BENCH_RUNS_MAX 64U
+#endif
+
+typedef void (*tru_bench_func_t)(void *arg);
+
+typedef struct{
+	const char *name;  // No spaces, it is used as a key by the host scripts
+	tru_bench_func_t func;
+	void *arg;
+	uint32_t bytes;    // Bytes processed per call for the throughput, 0 = not applicable
+}tru_bench_t;
+
+typedef struct{
+	uint32_t runs;
+	uint32_t min;
+	uint32_t median;
+	uint32_t max;
+	uint64_t total;
+	uint32_t l2_rd;      // L2 data read requests of all runs (TRU_BENCH_L2_EVENTS = 1U)
+	uint32_t l2_rd_hit;  // L2 data read hits of all runs (TRU_BENCH_L2_EVENTS = 1U)
+}tru_bench_result_t;
+
+uint32_t tru_bench_hz(void);
+uint32_t tru_bench_overhead(void);
+int32_t tru_bench_register(const tru_bench_t *bench);
+void tru_bench_run(const tru_bench_t *bench, uint32_t warmup, uint32_t runs, tru_bench_result_t *result);
+void tru_bench_print(const tru_bench_t *bench, const tru_bench_result_t *result);
+void tru_bench_run_all(uint32_t warmup, uint32_t runs);
+
+// Time stamp in the unit of the harness (TRU_BENCH_UNIT), also used by tru_jitter.h
+static inline uint32_t tru_bench_now(void){
+#if defined(TRU_BENCH_PMU) && TRU_BENCH_PMU == 1U
+	return tru_pmu_read_cycles();
+#else
+	return gtim_get_counter_low();
+#endif
+}
+
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Boot time profiler for Arm Cortex-A9.
+*/
+
+#include "tru_boot_prof.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9) && defined(TRU_BOOT_PROF) && TRU_BOOT_PROF == 1U
+
+#include "tru_time.h"
+#include <stdio.h>
+#include <inttypes.h>
+
+static const char *phase_names[TRU_BOOT_PHASE_COUNT] = {
+	"reset",
+	"clean_cache",
+	"sctlr",
+	"stacks",
+	"invalidate",
+	"mmu",
+	"l1_enable",
+	"l2_enable",
+	"irq_init",
+	"scu",
+	"start"
+};
+
+// Time stamps the end of newlib _start, which calls the constructors after the .data/.bss initialisation and just before main()
+__attribute__((constructor)) static void boot_prof_start(void){
+	TRU_BOOT_PROF_MARK(TRU_BOOT_PHASE_START);
+}
+
+// Invalidates the boot log of another core, call before releasing it from reset
+void tru_boot_prof_clear(uint32_t cpu){
+	if(cpu >= TRU_AMP_CPU_MAX) return;
+
+	tru_amp_shared.boot_log[cpu].magic = 0U;
+	__dmb();
+}
+
+// Copies the boot log of a core, returns false if the core has not written one
+bool tru_boot_prof_get(uint32_t cpu, tru_boot_log_t *log){
+	if(cpu >= TRU_AMP_CPU_MAX) return false;
+
+	*log = tru_amp_shared.boot_log[cpu];
+	return log->magic == TRU_BOOT_LOG_MAGIC;
+}
+
+void tru_boot_prof_print(uint32_t cpu){
+	tru_boot_log_t log;
+
+	if(!tru_boot_prof_get(cpu, &log)){
+		printf("BOOT NONE core=%" PRIu32 "\n", cpu);
+		return;
+	}
+
+	printf("BOOT BEGIN core=%" PRIu32 " hz=%" PRIu32 " reset=%" PRIu32 "\n", cpu, tru_time_base.hz, log.ts[TRU_BOOT_PHASE_RESET]);
+	for(uint32_t i = 1U; i < TRU_BOOT_PHASE_COUNT; i++){
+		uint32_t ticks = log.ts[i] - log.ts[i - 1U];  // Wraps correctly
+		uint32_t at = log.ts[i] - log.ts[TRU_BOOT_PHASE_RESET];
+		printf("BOOT %-11s ticks=%" PRIu32 " us=%" PRIu64 " at_us=%" PRIu64 "\n", phase_names[i], ticks, tru_time_ticks_to_us(ticks), tru_time_ticks_to_us(at));
+	}
+	printf("BOOT END total_us=%" PRIu64 "\n", tru_time_ticks_to_us(log.ts[TRU_BOOT_PHASE_COUNT - 1U] - log.ts[TRU_BOOT_PHASE_RESET]));
+}
+
+#endif
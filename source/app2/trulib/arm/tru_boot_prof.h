@@ -0,0 +1,116 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Boot time profiler for Arm Cortex-A9.
+
+	With TRU_CFG_BOOT_PROF = 1U, the startup code (startup_c5soc.c) and
+	SystemInit (system_c5soc.c) record the low word of the global timer at the
+	end of each startup phase into a per-core boot log.  The log is placed in
+	the memory shared between the cores (see tru_amp_shared.h), so that it
+	survives the .bss initialisation of newlib and can be read by the other
+	core.  The times wrap after 2^32 ticks (~21s at 200MHz), which is plenty
+	for a boot.
+
+	The phases, each time stamp is taken at the end of the phase:
+		RESET      : Reset_Handler entry (the global timer is enabled here if it is not running)
+		CLEAN_CACHE: L1 D cache clean of the previous (U-Boot) state
+		SCTLR      : SCTLR, ACTLR, NSACR and VBAR setup
+		STACKS     : stack painting and mode stacks setup
+		INVALIDATE : SystemInit TLB, branch predictor and L1 cache invalidation, FPU enable
+		MMU        : SystemInit MMU translation table build and MMU enable
+		L1_ENABLE  : SystemInit L1 caches and branch prediction enable
+		L2_ENABLE  : SystemInit L2 cache controller setup and enable
+		IRQ_INIT   : SystemInit IRQ_Initialize (GIC and handler table)
+		SCU        : SCU and SMP coherency setup
+		START      : newlib _start, i.e. .data/.bss initialisation and constructors, up to main()
+
+	The shared memory is not cleared by a reset, so the controlling core
+	(app1) calls tru_boot_prof_clear() for the other core before releasing
+	it.  Otherwise the log of a previous run would be printed as current,
+	e.g. after a warm reset or when app2 is built without the profiler.
+
+	The log is printed as text lines, after the UART is available:
+		BOOT BEGIN core=<n> hz=<global timer Hz> reset=<ticks>
+		BOOT <phase> ticks=<duration> us=<duration> at_us=<since reset>
+		BOOT END total_us=<reset to main>
+*/
+
+#ifndef TRU_BOOT_PROF_H
+#define TRU_BOOT_PROF_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+// Phase indexes, without the U suffix because they are also used by the startup assembly code
+#define TRU_BOOT_PHASE_RESET       0
+#define TRU_BOOT_PHASE_CLEAN_CACHE 1
+#define TRU_BOOT_PHASE_SCTLR       2
+#define TRU_BOOT_PHASE_STACKS      3
+#define TRU_BOOT_PHASE_INVALIDATE  4
+#define TRU_BOOT_PHASE_MMU         5
+#define TRU_BOOT_PHASE_L1_ENABLE   6
+#define TRU_BOOT_PHASE_L2_ENABLE   7
+#define TRU_BOOT_PHASE_IRQ_INIT    8
+#define TRU_BOOT_PHASE_SCU         9
+#define TRU_BOOT_PHASE_START       10
+#define TRU_BOOT_PHASE_COUNT       11
+
+// Boot log layout, also used by the startup assembly code
+#define TRU_BOOT_LOG_MAGIC     0x544f4f42  // "BOOT"
+#define TRU_BOOT_LOG_TS_OFFSET 4
+#define TRU_BOOT_LOG_SIZE      (TRU_BOOT_LOG_TS_OFFSET + 4 * TRU_BOOT_PHASE_COUNT)
+
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct{
+	uint32_t magic;                     // TRU_BOOT_LOG_MAGIC when the log was written by the startup code
+	uint32_t ts[TRU_BOOT_PHASE_COUNT];  // Global timer low word at the end of each phase
+}tru_boot_log_t;
+
+// Included after the log type, because the shared memory layout contains the log
+#include "tru_amp_shared.h"
+
+#if defined(TRU_BOOT_PROF) && TRU_BOOT_PROF == 1U
+	// Time stamps the end of a phase from C code running before main, e.g. SystemInit.  A macro so that it is never instrumented (fi=1)
+	#define TRU_BOOT_PROF_MARK(phase) \
+		do{ \
+			uint32_t boot_prof_mpidr; \
+			__read_mpidr(boot_prof_mpidr); \
+			tru_amp_shared.boot_log[boot_prof_mpidr & 0x3U].ts[(phase)] = gtim_get_counter_low(); \
+		}while(0)
+
+	void tru_boot_prof_clear(uint32_t cpu);
+	bool tru_boot_prof_get(uint32_t cpu, tru_boot_log_t *log);
+	void tru_boot_prof_print(uint32_t cpu);
+#else
+	#define TRU_BOOT_PROF_MARK(phase)
+#endif
+
+#endif
+
+#endif
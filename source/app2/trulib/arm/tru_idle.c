@@ -0,0 +1,147 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 idle and wakeup latency support.
+*/
+
+#include "tru_idle.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "RTE_Components.h"   // CMSIS
+#include CMSIS_device_header  // CMSIS
+
+#include <stdio.h>
+#include <inttypes.h>
+
+static uint32_t hot_ticks = TRU_IDLE_HOT_TICKS_DEFAULT;
+
+// Written by the comparator IRQ handler during latency measurement
+static volatile uint64_t irq_time;
+static volatile uint32_t irq_fired;
+
+void tru_idle_set_hot_ticks(uint32_t ticks){
+	hot_ticks = ticks;
+}
+
+uint32_t tru_idle_get_hot_ticks(void){
+	return hot_ticks;
+}
+
+// Wait until an interrupt handler sets the flag (non-zero).  IRQs are unmasked while waiting, and the IRQ mask of the caller is restored on return
+void tru_idle_until(volatile uint32_t *flag){
+	// Stay hot: busy-poll for a short window first (needs the global timer running)
+	if(hot_ticks && gtim_is_enabled()){
+		uint64_t end = gtim_get_counter() + hot_ticks;
+		while(*flag == 0U && gtim_get_counter() < end);
+	}
+
+	// IRQs are masked while testing the flag, so an interrupt cannot set it between the test and WFI.  WFI still wakes on the pending interrupt
+	uint32_t cpsr = tru_irq_save();
+	while(*flag == 0U){
+		tru_idle_wfi();
+		__cpsie_i();  // Service the pending interrupt
+		__cpsid_i();
+	}
+	tru_irq_restore(cpsr);
+}
+
+// ==========================
+// Wakeup latency measurement
+// ==========================
+
+static void gtim_irq_handler(void){
+	irq_time = gtim_get_counter();
+	gtim_compare_irq_disable();
+	gtim_clear_event();
+	irq_fired = 1U;
+}
+
+void tru_idle_latency_init(tru_idle_latency_t *lat){
+	lat->samples = 0U;
+	lat->min = UINT32_MAX;
+	lat->max = 0U;
+	lat->total = 0U;
+}
+
+void tru_idle_latency_add(tru_idle_latency_t *lat, uint32_t ticks){
+	lat->samples++;
+	if(ticks < lat->min) lat->min = ticks;
+	if(ticks > lat->max) lat->max = ticks;
+	lat->total += ticks;
+}
+
+// Prints one line of min, average and max, nothing if there are no samples
+void tru_idle_latency_print(const char *name, const tru_idle_latency_t *lat){
+	if(lat->samples){
+		printf("  %s: min %" PRIu32 ", avg %" PRIu32 ", max %" PRIu32 " (%" PRIu32 " samples)\n", name, lat->min, (uint32_t)(lat->total / lat->samples), lat->max, lat->samples);
+	}
+}
+
+// Arms the global timer comparator interrupt delay_ticks from now and returns the compare value, i.e. the time of the event.
+// delay_ticks must be long enough for the comparator to be armed before the counter reaches it
+uint64_t tru_idle_gtim_arm(uint32_t delay_ticks){
+	uint64_t compare = gtim_get_counter() + delay_ticks;
+	gtim_set_compare(compare);
+	gtim_compare_irq_enable();
+	return compare;
+}
+
+// Measures the delay from a global timer comparator event to the entry of its IRQ handler, alternating between sleeping in WFI and busy-polling.
+// delay_ticks must be long enough for the comparator to be armed before the counter reaches it
+void tru_idle_measure_latency(uint32_t samples, uint32_t delay_ticks, tru_idle_stats_t *stats){
+	IRQHandler_t prev_handler = IRQ_GetHandler(GTIM_IRQ_ID);
+
+	tru_idle_latency_init(&stats->wfi);
+	tru_idle_latency_init(&stats->hot);
+
+	if(!gtim_is_enabled()) gtim_enable();
+	IRQ_SetHandler(GTIM_IRQ_ID, gtim_irq_handler);
+	IRQ_Enable(GTIM_IRQ_ID);
+
+	for(uint32_t i = 0U; i < samples * 2U; i++){
+		irq_fired = 0U;
+		uint64_t compare = tru_idle_gtim_arm(delay_ticks);
+
+		if((i & 1U) == 0U){
+			tru_idle_until(&irq_fired);
+			tru_idle_latency_add(&stats->wfi, (uint32_t)(irq_time - compare));
+		}else{
+			while(irq_fired == 0U);
+			tru_idle_latency_add(&stats->hot, (uint32_t)(irq_time - compare));
+		}
+	}
+
+	IRQ_Disable(GTIM_IRQ_ID);
+	IRQ_SetHandler(GTIM_IRQ_ID, prev_handler);
+}
+
+void tru_idle_print_stats(const tru_idle_stats_t *stats){
+	printf("Wakeup latency (global timer ticks):\n");
+	tru_idle_latency_print("WFI", &stats->wfi);
+	tru_idle_latency_print("Hot", &stats->hot);
+}
+
+#endif
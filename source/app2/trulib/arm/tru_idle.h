@@ -0,0 +1,94 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 idle and wakeup latency support.
+
+	An idle core should sleep in WFI rather than spin, a spinning core burns
+	full power and keeps issuing memory requests.  The cost of WFI is the
+	wakeup latency, which can be measured here using the global timer
+	comparator interrupt.  For wait paths that need a faster response, a "stay
+	hot" window can be configured, the wait functions will first busy-poll for
+	this number of global timer ticks before entering WFI.
+*/
+
+#ifndef TRU_IDLE_H
+#define TRU_IDLE_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+
+// Default "stay hot" busy-poll window in global timer ticks, 0 = always enter WFI straight away
+#if defined(TRU_IDLE_HOT_TICKS)
+	#define TRU_IDLE_HOT_TICKS_DEFAULT TRU_IDLE_HOT_TICKS
+#else
+	#define TRU_IDLE_HOT_TICKS_DEFAULT 0U
+#endif
+
+// Latency accumulator, also used by tru_irq_stats.h
+typedef struct{
+	uint32_t samples;
+	uint32_t min;    // Global timer ticks
+	uint32_t max;    // Global timer ticks
+	uint64_t total;  // Global timer ticks, for the average
+}tru_idle_latency_t;
+
+typedef struct{
+	tru_idle_latency_t wfi;  // Comparator event to IRQ handler entry, while sleeping in WFI
+	tru_idle_latency_t hot;  // Comparator event to IRQ handler entry, while busy-polling
+}tru_idle_stats_t;
+
+// Enter WFI once.  With IRQs masked the core still wakes up on a pending interrupt, but the handler will only run when unmasked
+static inline void tru_idle_wfi(void){
+	__dsb();  // Complete outstanding memory transactions before sleeping
+	__wfi();
+}
+
+// Sleep forever, the core only wakes up to service interrupts
+static inline void __attribute__((noreturn)) tru_idle_forever(void){
+	while(1) tru_idle_wfi();
+}
+
+// Wait with WFE for a flag set by the other core, the other core must execute __dsb() and __sev() after setting the flag
+static inline void tru_idle_wfe_until(volatile uint32_t *flag){
+	while(*flag == 0U) __wfe();
+}
+
+void tru_idle_set_hot_ticks(uint32_t ticks);
+uint32_t tru_idle_get_hot_ticks(void);
+void tru_idle_until(volatile uint32_t *flag);
+void tru_idle_latency_init(tru_idle_latency_t *lat);
+void tru_idle_latency_add(tru_idle_latency_t *lat, uint32_t ticks);
+void tru_idle_latency_print(const char *name, const tru_idle_latency_t *lat);
+uint64_t tru_idle_gtim_arm(uint32_t delay_ticks);
+void tru_idle_measure_latency(uint32_t samples, uint32_t delay_ticks, tru_idle_stats_t *stats);
+void tru_idle_print_stats(const tru_idle_stats_t *stats);
+
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Interrupt statistics and latency measurement for Arm Cortex-A9.
+
+	With TRU_CFG_IRQ_STATS = 1U, IRQ_Handler (irq_c5soc.c) reads the low word
+	of the global timer on entry into tru_irq_entry_ts, and times each
+	registered handler into tru_irq_stats[] (count, total and max duration).
+	All times are in global timer ticks (see tru_time.h for conversion).
+
+	The entry latency is measured from an event with a known time to the
+	entry of IRQ_Handler and to the start of the registered handler:
+		- TRU_IRQ_LATENCY_GTIM: the global timer comparator
+		- TRU_IRQ_LATENCY_SGI : a software generated interrupt sent to itself
+
+	The statistics are printed as text lines, one per interrupt:
+		IRQSTAT <id> count=<n> total=<ticks> max=<ticks>
+*/
+
+#ifndef TRU_IRQ_STATS_H
+#define TRU_IRQ_STATS_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include "tru_idle.h"
+#include <stdint.h>
+
+// SGI ID used for the latency measurement, must differ from TRU_AMP_LOAD_SGI_ID (tru_amp_load.h)
+#ifndef TRU_IRQ_LATENCY_SGI_ID
+	#define TRU_IRQ_LATENCY_SGI_ID 15U
+#endif
+
+typedef struct{
+	uint32_t count;
+	uint32_t max;    // Longest handler duration
+	uint64_t total;  // Total handler duration
+}tru_irq_stats_t;
+
+typedef struct{
+	tru_idle_latency_t entry;    // Event to IRQ_Handler entry
+	tru_idle_latency_t handler;  // Event to the registered handler
+}tru_irq_latency_stats_t;
+
+typedef enum{
+	TRU_IRQ_LATENCY_GTIM = 0,
+	TRU_IRQ_LATENCY_SGI
+}tru_irq_latency_src_t;
+
+#if defined(TRU_IRQ_STATS) && TRU_IRQ_STATS == 1U
+	extern tru_irq_stats_t tru_irq_stats[];
+	extern volatile uint32_t tru_irq_entry_ts;  // Global timer low word at the last IRQ_Handler entry
+
+	// Called by IRQ_Handler after each registered handler
+	static inline void tru_irq_stats_add(uint32_t irq_id, uint32_t ticks){
+		tru_irq_stats_t *stats = &tru_irq_stats[irq_id];
+		stats->count++;
+		stats->total += ticks;
+		if(ticks > stats->max) stats->max = ticks;
+	}
+
+	void tru_irq_stats_get(uint32_t irq_id, tru_irq_stats_t *stats);
+	void tru_irq_stats_clear(void);
+	void tru_irq_stats_print(void);
+	int32_t tru_irq_measure_latency(tru_irq_latency_src_t src, uint32_t samples, tru_irq_latency_stats_t *stats);
+	void tru_irq_print_latency(const tru_irq_latency_stats_t *stats);
+#endif
+
+#endif
+
+#endif
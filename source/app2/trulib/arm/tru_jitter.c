@@ -0,0 +1,99 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Jitter (timing determinism) measurement for Arm Cortex-A9.
+*/
+
+#include "tru_jitter.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include "tru_bench.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+
+void tru_jitter_hist_reset(tru_jitter_hist_t *hist){
+	memset(hist->counts, 0, sizeof(hist->counts));
+	hist->iters = 0U;
+	hist->min = UINT32_MAX;
+	hist->max = 0U;
+	hist->total = 0U;
+}
+
+// Returns the upper end of the bucket holding the percentile, given in parts per million (e.g. 999000U for p99.9)
+uint32_t tru_jitter_hist_percentile(const tru_jitter_hist_t *hist, uint32_t ppm){
+	uint64_t rank = ((uint64_t)hist->iters * ppm + 999999U) / 1000000U;  // Round up, so that the percentile includes at least that many samples
+	uint64_t count = 0U;
+
+	if(hist->iters == 0U) return 0U;
+	if(rank == 0U) rank = 1U;
+
+	for(uint32_t i = 0U; i < TRU_JITTER_HIST_BUCKETS; i++){
+		count += hist->counts[i];
+		if(count >= rank){
+			uint32_t upper = (i + 1U < TRU_JITTER_HIST_BUCKETS) ? tru_jitter_hist_value(i + 1U) - 1U : UINT32_MAX;
+			return (upper < hist->max) ? upper : hist->max;  // The exact max is known, so do not report beyond it
+		}
+	}
+	return hist->max;
+}
+
+// Calls the kernel iters times and records the time of each call.  The histogram is reset first
+void tru_jitter_run(const tru_jitter_t *jitter, uint32_t iters, tru_jitter_hist_t *hist){
+	uint32_t overhead = tru_bench_overhead();  // Same time source and call overhead as the benchmarks
+
+	tru_jitter_hist_reset(hist);
+	jitter->func(jitter->arg);  // Warm up the caches and branch predictor
+
+	for(uint32_t i = 0U; i < iters; i++){
+		uint32_t cpsr = 0U;
+		if(!jitter->irq_on) cpsr = tru_irq_save();
+		uint32_t start = tru_bench_now();
+		jitter->func(jitter->arg);
+		uint32_t ticks = tru_bench_now() - start;
+		if(!jitter->irq_on) tru_irq_restore(cpsr);
+
+		tru_jitter_hist_record(hist, (ticks > overhead) ? ticks - overhead : 0U);
+	}
+}
+
+void tru_jitter_print(const tru_jitter_t *jitter, const tru_jitter_hist_t *hist){
+	if(hist->iters == 0U) return;
+
+	printf("JITTER %s unit=%s hz=%" PRIu32 " iters=%" PRIu32 " min=%" PRIu32, jitter->name, TRU_BENCH_UNIT, tru_bench_hz(), hist->iters, hist->min);
+	printf(" p50=%" PRIu32 " p90=%" PRIu32 " p99=%" PRIu32, tru_jitter_hist_percentile(hist, 500000U), tru_jitter_hist_percentile(hist, 900000U), tru_jitter_hist_percentile(hist, 990000U));
+	printf(" p999=%" PRIu32 " p9999=%" PRIu32 " p999999=%" PRIu32, tru_jitter_hist_percentile(hist, 999000U), tru_jitter_hist_percentile(hist, 999900U), tru_jitter_hist_percentile(hist, 999999U));
+	printf(" max=%" PRIu32 " avg=%" PRIu32 "\n", hist->max, (uint32_t)(hist->total / hist->iters));
+
+	for(uint32_t i = 0U; i < TRU_JITTER_HIST_BUCKETS; i++){
+		if(hist->counts[i]) printf("JHIST %s %" PRIu32 " %" PRIu32 "\n", jitter->name, tru_jitter_hist_value(i), hist->counts[i]);
+	}
+}
+
+#endif
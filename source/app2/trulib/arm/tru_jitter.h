@@ -0,0 +1,121 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Jitter (timing determinism) measurement for Arm Cortex-A9.
+
+	A fixed workload (kernel) is called many times in a tight loop and the
+	time of every call is recorded into a histogram, so that the whole
+	distribution is kept with a constant memory size, however many calls are
+	made.  Run it while the other core generates interference (see
+	tru_amp_load.h) to check the isolation of the cores.
+
+	The histogram is HDR (high dynamic range) style: values below
+	2^TRU_JITTER_HIST_SUB_BITS have their own bucket, larger values are
+	bucketed by their power of two, which is split linearly into
+	2^(TRU_JITTER_HIST_SUB_BITS - 1) sub-buckets.  The bucket width is
+	therefore always less than 1 / 2^(TRU_JITTER_HIST_SUB_BITS - 1) of the
+	value (6.25% for the default), for the full 32-bit range.
+
+	The time source and the subtracted call overhead are those of the
+	benchmark harness (tru_bench_now() and tru_bench_overhead() in
+	tru_bench.h): the global timer tick by default, or the PMU cycle counter
+	with TRU_BENCH_PMU = 1U.
+
+	Results are printed as one machine-parseable line, followed by the
+	non-empty buckets:
+		JITTER <name> unit=<ticks|cycles> hz=<hz> iters=<n> min=<t> p50=<t> p90=<t> p99=<t> p999=<t> p9999=<t> p999999=<t> max=<t> avg=<t>
+		JHIST <name> <lowest value of the bucket> <count>
+	The percentiles are the upper end of the bucket.  Use
+	scripts-py/jitter_report.py on the host to tabulate and plot them.
+*/
+
+#ifndef TRU_JITTER_H
+#define TRU_JITTER_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bits of precision of the histogram
+#ifndef TRU_JITTER_HIST_SUB_BITS
+	#define TRU_JITTER_HIST_SUB_BITS 5U
+#endif
+
+#define TRU_JITTER_HIST_SUB_COUNT (1U << TRU_JITTER_HIST_SUB_BITS)
+#define TRU_JITTER_HIST_SUB_HALF  (TRU_JITTER_HIST_SUB_COUNT / 2U)
+#define TRU_JITTER_HIST_BUCKETS   ((32U - TRU_JITTER_HIST_SUB_BITS + 2U) * TRU_JITTER_HIST_SUB_HALF)
+
+typedef void (*tru_jitter_func_t)(void *arg);
+
+typedef struct{
+	const char *name;  // No spaces, it is used as a key by the host scripts
+	tru_jitter_func_t func;
+	void *arg;
+	bool irq_on;       // Leave IRQs enabled during the calls, to include the interrupt latency in the result
+}tru_jitter_t;
+
+typedef struct{
+	uint32_t counts[TRU_JITTER_HIST_BUCKETS];
+	uint32_t iters;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+}tru_jitter_hist_t;
+
+// Bucket of a value
+static inline uint32_t tru_jitter_hist_index(uint32_t val){
+	if(val < TRU_JITTER_HIST_SUB_COUNT) return val;
+
+	uint32_t shift = 31U - __builtin_clz(val) - (TRU_JITTER_HIST_SUB_BITS - 1U);
+	return (shift + 1U) * TRU_JITTER_HIST_SUB_HALF + (val >> shift) - TRU_JITTER_HIST_SUB_HALF;
+}
+
+// Lowest value of a bucket
+static inline uint32_t tru_jitter_hist_value(uint32_t index){
+	if(index < TRU_JITTER_HIST_SUB_COUNT) return index;
+
+	uint32_t shift = index / TRU_JITTER_HIST_SUB_HALF - 1U;
+	return (index % TRU_JITTER_HIST_SUB_HALF + TRU_JITTER_HIST_SUB_HALF) << shift;
+}
+
+static inline void tru_jitter_hist_record(tru_jitter_hist_t *hist, uint32_t val){
+	hist->counts[tru_jitter_hist_index(val)]++;
+	hist->iters++;
+	hist->total += val;
+	if(val < hist->min) hist->min = val;
+	if(val > hist->max) hist->max = val;
+}
+
+void tru_jitter_hist_reset(tru_jitter_hist_t *hist);
+uint32_t tru_jitter_hist_percentile(const tru_jitter_hist_t *hist, uint32_t ppm);
+void tru_jitter_run(const tru_jitter_t *jitter, uint32_t iters, tru_jitter_hist_t *hist);
+void tru_jitter_print(const tru_jitter_t *jitter, const tru_jitter_hist_t *hist);
+
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 Performance Monitor Unit (PMU).
+
+	The PMU has a 32-bit cycle counter (PMCCNTR) and six 32-bit event counters,
+	each of which can count one event selected from the table below.  The
+	counters are per processor (core), so a measurement is only meaningful on
+	the core that runs the measured code.
+
+	A measurement object accumulates the counter deltas of many begin/end
+	pairs on the calling core, e.g.:
+		static tru_pmu_measure_t m = { .name = "filter" };
+		TRU_PMU_SCOPE(&m){
+			filter_run();
+		}
+		tru_pmu_measure_print(&m);
+
+	Each app of this AMP system runs on its own core with its own copy of the
+	measurement objects, so a measurement holds the counts of one core only.
+
+	Deltas use 32-bit wraparound arithmetic, so a single measured scope must
+	be shorter than 2^32 cycles (about 5 seconds at 800MHz).
+
+	See the Cortex-A9 Technical Reference Manual, section Performance
+	Monitoring Unit, for the event descriptions.
+*/
+
+#ifndef TRU_PMU_H
+#define TRU_PMU_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include "tru_cortex_a9.h"
+#include <stdint.h>
+
+#define TRU_PMU_NUM_COUNTERS 6U
+
+// PMCR bits
+#define TRU_PMU_PMCR_E_MSK (0x1U << 0U)  // Enable all counters
+#define TRU_PMU_PMCR_P_MSK (0x1U << 1U)  // Reset event counters
+#define TRU_PMU_PMCR_C_MSK (0x1U << 2U)  // Reset cycle counter
+#define TRU_PMU_PMCR_D_MSK (0x1U << 3U)  // Cycle counter counts every 64th cycle
+#define TRU_PMU_PMCR_N_POS 11U           // Number of event counters
+#define TRU_PMU_PMCR_N_MSK (0x1fU << TRU_PMU_PMCR_N_POS)
+
+// Cycle counter bit in PMCNTENSET, PMCNTENCLR and PMOVSR
+#define TRU_PMU_CYCLE_CNT_MSK (0x1U << 31U)
+
+// CP15 PMU registers
+#define __read_pmcr(result)       __asm__ volatile("MRC p15, 0, %0, c9, c12, 0" : "=r"(result) : : "memory")
+#define __write_pmcr(val)         __asm__ volatile("MCR p15, 0, %0, c9, c12, 0" : : "r"(val) : "memory")
+#define __write_pmcntenset(val)   __asm__ volatile("MCR p15, 0, %0, c9, c12, 1" : : "r"(val) : "memory")
+#define __write_pmcntenclr(val)   __asm__ volatile("MCR p15, 0, %0, c9, c12, 2" : : "r"(val) : "memory")
+#define __read_pmovsr(result)     __asm__ volatile("MRC p15, 0, %0, c9, c12, 3" : "=r"(result) : : "memory")
+#define __write_pmovsr(val)       __asm__ volatile("MCR p15, 0, %0, c9, c12, 3" : : "r"(val) : "memory")
+#define __write_pmselr(val)       __asm__ volatile("MCR p15, 0, %0, c9, c12, 5" : : "r"(val) : "memory")
+#define __read_pmccntr(result)    __asm__ volatile("MRC p15, 0, %0, c9, c13, 0" : "=r"(result) : : "memory")
+#define __write_pmxevtyper(val)   __asm__ volatile("MCR p15, 0, %0, c9, c13, 1" : : "r"(val) : "memory")
+#define __read_pmxevcntr(result)  __asm__ volatile("MRC p15, 0, %0, c9, c13, 2" : "=r"(result) : : "memory")
+#define __write_pmintenclr(val)   __asm__ volatile("MCR p15, 0, %0, c9, c14, 2" : : "r"(val) : "memory")
+
+// Cortex-A9 events
+typedef enum{
+	TRU_PMU_EVT_SW_INCR            = 0x00U,  // Software increment
+	TRU_PMU_EVT_L1I_REFILL         = 0x01U,  // Instruction cache miss
+	TRU_PMU_EVT_ITLB_REFILL        = 0x02U,  // Instruction micro TLB miss
+	TRU_PMU_EVT_L1D_REFILL         = 0x03U,  // Data cache miss
+	TRU_PMU_EVT_L1D_ACCESS         = 0x04U,  // Data cache access
+	TRU_PMU_EVT_DTLB_REFILL        = 0x05U,  // Data micro TLB miss
+	TRU_PMU_EVT_LOAD               = 0x06U,  // Data reads
+	TRU_PMU_EVT_STORE              = 0x07U,  // Data writes
+	TRU_PMU_EVT_EXC_TAKEN          = 0x09U,  // Exceptions taken
+	TRU_PMU_EVT_EXC_RETURN         = 0x0aU,  // Exception returns
+	TRU_PMU_EVT_CID_WRITE          = 0x0bU,  // Context ID changes
+	TRU_PMU_EVT_PC_WRITE           = 0x0cU,  // Software change of PC
+	TRU_PMU_EVT_BR_IMMED           = 0x0dU,  // Immediate branches
+	TRU_PMU_EVT_UNALIGNED          = 0x0fU,  // Unaligned accesses
+	TRU_PMU_EVT_BR_MISPRED         = 0x10U,  // Branch mispredicted or not predicted
+	TRU_PMU_EVT_CYCLES             = 0x11U,  // Cycles
+	TRU_PMU_EVT_BR_PRED            = 0x12U,  // Predictable branches
+	TRU_PMU_EVT_COH_LF_MISS        = 0x50U,  // Coherent linefill misses (data came from memory)
+	TRU_PMU_EVT_COH_LF_HIT         = 0x51U,  // Coherent linefill hits (data came from the other core)
+	TRU_PMU_EVT_ICACHE_STALL       = 0x60U,  // Stall cycles, instruction cache dependent
+	TRU_PMU_EVT_DCACHE_STALL       = 0x61U,  // Stall cycles, data cache dependent
+	TRU_PMU_EVT_TLB_STALL          = 0x62U,  // Stall cycles, main TLB miss
+	TRU_PMU_EVT_STREX_PASS         = 0x63U,  // STREX passed
+	TRU_PMU_EVT_STREX_FAIL         = 0x64U,  // STREX failed
+	TRU_PMU_EVT_DATA_EVICTION      = 0x65U,  // Data cache evictions
+	TRU_PMU_EVT_ISSUE_NO_DISPATCH  = 0x66U,  // Cycles issue stage does not dispatch
+	TRU_PMU_EVT_ISSUE_EMPTY        = 0x67U,  // Cycles issue stage is empty
+	TRU_PMU_EVT_INST_RENAME        = 0x68U,  // Instructions out of the rename stage (approximates instructions executed)
+	TRU_PMU_EVT_PRED_FUNC_RET      = 0x6eU,  // Predictable function returns
+	TRU_PMU_EVT_MAIN_UNIT_INST     = 0x70U,  // Main execution unit instructions
+	TRU_PMU_EVT_SECOND_UNIT_INST   = 0x71U,  // Second execution unit instructions
+	TRU_PMU_EVT_LDST_INST          = 0x72U,  // Load/store instructions
+	TRU_PMU_EVT_FP_INST            = 0x73U,  // Floating point instructions
+	TRU_PMU_EVT_NEON_INST          = 0x74U,  // NEON instructions
+	TRU_PMU_EVT_PLD_STALL          = 0x80U,  // Stall cycles, PLD
+	TRU_PMU_EVT_WRITE_STALL        = 0x81U,  // Stall cycles, memory write
+	TRU_PMU_EVT_ITLB_STALL         = 0x82U,  // Stall cycles, main ITLB miss
+	TRU_PMU_EVT_DTLB_STALL         = 0x83U,  // Stall cycles, main DTLB miss
+	TRU_PMU_EVT_MICRO_ITLB_STALL   = 0x84U,  // Stall cycles, micro ITLB miss
+	TRU_PMU_EVT_MICRO_DTLB_STALL   = 0x85U,  // Stall cycles, micro DTLB miss
+	TRU_PMU_EVT_DMB_STALL          = 0x86U,  // Stall cycles, DMB
+	TRU_PMU_EVT_INT_CLK_EN         = 0x8aU,  // Integer core clock enabled cycles
+	TRU_PMU_EVT_DE_CLK_EN          = 0x8bU,  // Data engine clock enabled cycles
+	TRU_PMU_EVT_ISB                = 0x90U,  // ISB instructions
+	TRU_PMU_EVT_DSB                = 0x91U,  // DSB instructions
+	TRU_PMU_EVT_DMB                = 0x92U,  // DMB instructions
+	TRU_PMU_EVT_EXT_IRQ            = 0x93U,  // External interrupts
+	TRU_PMU_EVT_PLE_LINE_DONE      = 0xa0U,  // PLE cache line requests completed
+	TRU_PMU_EVT_PLE_LINE_SKIP      = 0xa1U,  // PLE cache line requests skipped
+	TRU_PMU_EVT_PLE_FIFO_FLUSH     = 0xa2U,  // PLE FIFO flushes
+	TRU_PMU_EVT_PLE_REQ_DONE       = 0xa3U,  // PLE requests completed
+	TRU_PMU_EVT_PLE_FIFO_OVERFLOW  = 0xa4U,  // PLE FIFO overflows
+	TRU_PMU_EVT_PLE_REQ_PROG       = 0xa5U   // PLE requests programmed
+}tru_pmu_event_t;
+
+typedef struct{
+	uint32_t cycles;
+	uint32_t counters[TRU_PMU_NUM_COUNTERS];
+}tru_pmu_sample_t;
+
+typedef struct{
+	uint32_t count;   // Number of measured scopes
+	uint32_t cycles_min;
+	uint32_t cycles_max;
+	uint64_t cycles;  // Total
+	uint64_t counters[TRU_PMU_NUM_COUNTERS];  // Totals
+	tru_pmu_sample_t start;
+}tru_pmu_acc_t;
+
+typedef struct{
+	const char *name;
+	tru_pmu_acc_t acc;
+}tru_pmu_measure_t;
+
+void tru_pmu_init(void);
+void tru_pmu_set_events(const tru_pmu_event_t *events, uint32_t num);
+tru_pmu_event_t tru_pmu_get_event(uint32_t counter);
+const char *tru_pmu_event_name(tru_pmu_event_t event);
+void tru_pmu_reset(void);
+void tru_pmu_measure_clear(tru_pmu_measure_t *m);
+void tru_pmu_measure_print(const tru_pmu_measure_t *m);
+
+static inline uint32_t tru_pmu_read_cycles(void){
+	uint32_t val;
+	__read_pmccntr(val);
+	return val;
+}
+
+static inline uint32_t tru_pmu_read_counter(uint32_t counter){
+	uint32_t val;
+	__write_pmselr(counter);
+	__isb();
+	__read_pmxevcntr(val);
+	return val;
+}
+
+static inline void tru_pmu_read_sample(tru_pmu_sample_t *sample){
+	for(uint32_t i = 0U; i < TRU_PMU_NUM_COUNTERS; i++){
+		sample->counters[i] = tru_pmu_read_counter(i);
+	}
+	sample->cycles = tru_pmu_read_cycles();
+}
+
+static inline void tru_pmu_measure_begin(tru_pmu_measure_t *m){
+	tru_pmu_read_sample(&m->acc.start);
+}
+
+static inline void tru_pmu_measure_end(tru_pmu_measure_t *m){
+	// Cycles first, so the event counter reads are not included
+	uint32_t cycles = tru_pmu_read_cycles();
+	tru_pmu_acc_t *acc = &m->acc;
+
+	uint32_t delta = cycles - acc->start.cycles;
+	acc->count++;
+	acc->cycles += delta;
+	if(acc->count == 1U || delta < acc->cycles_min) acc->cycles_min = delta;
+	if(delta > acc->cycles_max) acc->cycles_max = delta;
+	for(uint32_t i = 0U; i < TRU_PMU_NUM_COUNTERS; i++){
+		acc->counters[i] += tru_pmu_read_counter(i) - acc->start.counters[i];
+	}
+}
+
+// Measures the statement or block that follows it
+#define TRU_PMU_SCOPE(m) for(uint32_t pmu_scope_once = (tru_pmu_measure_begin(m), 1U); pmu_scope_once; pmu_scope_once = (tru_pmu_measure_end(m), 0U))
+
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Statistical PC sampling profiler for Arm Cortex-A9.
+
+	The private watchdog of each core is used in timer mode as the sample
+	clock, so the private timer stays free for the software timer service
+	(tru_timer.h).  On each watchdog interrupt the interrupted PC, captured by
+	IRQ_Handler (irq_c5soc.c) into tru_prof_irq_pc, is counted into a
+	histogram covering the .text section.  Each bin covers 2^shift bytes,
+	the shift is chosen at start so that .text fits into TRU_PROF_BINS.
+
+	Requires TRU_CFG_PROF = 1U, so that IRQ_Handler captures the PC.  The
+	samples of code running with IRQs masked are attributed to the
+	instruction after they are unmasked.
+
+	tru_prof_dump() prints the histogram as text lines, which are turned into
+	a flat profile and folded stacks (for flamegraph.pl) on the host with:
+		scripts-py/prof_report.py <elf> <captured uart log>
+*/
+
+#ifndef TRU_PROF_H
+#define TRU_PROF_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+
+#ifndef TRU_PROF_BINS
+	#define TRU_PROF_BINS 4096U
+#endif
+
+// Interrupted PC, written by IRQ_Handler on each interrupt when TRU_PROF == 1U
+extern volatile uint32_t tru_prof_irq_pc;
+
+#if defined(TRU_PROF) && TRU_PROF == 1U
+	int32_t tru_prof_start(uint32_t rate_hz);
+	void tru_prof_stop(void);
+	void tru_prof_clear(void);
+	void tru_prof_dump(void);
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Arm Cortex-A9 processor mode stack usage (high-water mark) measurement.
+
+	The startup code paints every mode stack with TRU_STACK_PAINT_PATTERN
+	before the stack pointers are set.  The high-water mark is found by
+	scanning each stack from its base (lowest address) upwards for the first
+	word that was overwritten.  Stacks grow downwards, so an overwritten base
+	word means the stack has overflowed into whatever the linker placed below.
+*/
+
+#ifndef TRU_STACK_H
+#define TRU_STACK_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Must match with the pattern used by the startup code (startup_c5soc.c)
+#define TRU_STACK_PAINT_PATTERN 0xa5a5a5a5U
+
+typedef enum{
+	TRU_STACK_FIQ = 0,
+	TRU_STACK_IRQ,
+	TRU_STACK_SVC,
+	TRU_STACK_ABT,
+	TRU_STACK_UND,
+	TRU_STACK_SYS,  // This is also for the user mode, because they use the same stack pointer
+	TRU_STACK_MODE_COUNT
+}tru_stack_mode_t;
+
+typedef struct{
+	uint32_t base;   // Lowest address
+	uint32_t limit;  // Highest address (initial stack pointer)
+	uint32_t size;   // Size in bytes
+	uint32_t used;   // High-water mark in bytes
+	bool overflow;   // The lowest word was overwritten, the stack has likely overflowed
+}tru_stack_usage_t;
+
+typedef struct{
+	uint32_t cpu;  // Processor (core) number from MPIDR
+	tru_stack_usage_t mode[TRU_STACK_MODE_COUNT];
+}tru_stack_report_t;
+
+#if defined(TRU_STACK_PAINT) && TRU_STACK_PAINT == 1U
+	void tru_stack_get_usage(tru_stack_mode_t mode, tru_stack_usage_t *usage);
+	void tru_stack_get_report(tru_stack_report_t *report);
+	void tru_stack_print_report(void);
+#endif
+
+#endif
+
+#endif
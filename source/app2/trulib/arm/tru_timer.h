@@ -0,0 +1,101 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Software timer service for Arm Cortex-A9 using the private timer.
+
+	Active timers are kept in a binary min-heap ordered by expiry time, so
+	starting or stopping a timer is O(log n) and the next deadline is always
+	at the top.  Expiry times are absolute global timer ticks (64-bit, no
+	wrap).  Callbacks run in the private timer IRQ handler context.
+
+	Tickless mode (tick = 0): the private timer is loaded as a one-shot with
+	the delta to the next deadline only, and is stopped when there are no
+	active timers, so an idle system takes no timer interrupts.
+
+	Periodic mode (tick > 0): the private timer interrupts at a fixed rate and
+	expired timers are serviced on each tick.  This is only provided for
+	comparison, deadlines are rounded up to the tick.
+
+	Jitter is recorded per timer as the lateness of each callback, i.e. the
+	time from the expiry to the callback start.  Periodic timers are
+	re-armed relative to their previous expiry, so lateness does not
+	accumulate as drift.
+*/
+
+#ifndef TRU_TIMER_H
+#define TRU_TIMER_H
+
+#include "tru_config.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_CORTEXA9)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Maximum number of active timers
+#if defined(TRU_TIMER_MAX)
+	#define TRU_TIMER_MAX_ACTIVE TRU_TIMER_MAX
+#else
+	#define TRU_TIMER_MAX_ACTIVE 64U
+#endif
+
+typedef void (*tru_timer_func_t)(void *arg);
+
+typedef struct{
+	uint32_t count;    // Number of callbacks
+	uint32_t missed;   // Periodic expiries skipped because the callback was later than a whole period
+	uint32_t min;      // Lateness, global timer ticks
+	uint32_t max;      // Lateness, global timer ticks
+	uint64_t total;    // Lateness, global timer ticks, for the average
+}tru_timer_stats_t;
+
+typedef struct{
+	tru_timer_func_t func;
+	void *arg;
+	uint64_t expiry;      // Absolute global timer ticks
+	uint32_t period;      // Global timer ticks, 0 = one-shot
+	uint32_t heap_index;  // Position in the heap, TRU_TIMER_INACTIVE when not started
+	tru_timer_stats_t stats;
+}tru_timer_t;
+
+#define TRU_TIMER_INACTIVE 0xffffffffU
+
+int32_t tru_timer_service_init(uint32_t tick);
+bool tru_timer_service_is_init(void);
+uint32_t tru_timer_service_irq_count(void);
+void tru_timer_init(tru_timer_t *timer, tru_timer_func_t func, void *arg);
+int32_t tru_timer_start(tru_timer_t *timer, uint64_t delay, uint32_t period);
+int32_t tru_timer_start_at(tru_timer_t *timer, uint64_t expiry, uint32_t period);
+void tru_timer_stop(tru_timer_t *timer);
+void tru_timer_reset_stats(tru_timer_t *timer);
+void tru_timer_print_stats(const tru_timer_t *timer, const char *name);
+
+static inline bool tru_timer_is_active(const tru_timer_t *timer){
+	return timer->heap_index != TRU_TIMER_INACTIVE;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,68 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Board support for the QEMU vexpress-a9 machine (Arm Versatile Express
+	with a CoreTile Express A9x4).
+
+	It has the same Cortex-A9 MPCore as the Cyclone V SoC, i.e. SCU, GIC,
+	global and private timers, and an L2C-310, but at a different base
+	address.  There are no HPS peripherals, so the clock is fixed and printf
+	is re-targeted to the PL011 UART0 (or Semihosting with semi=1).
+
+	Built with the qemu=1 make option, run with:
+		qemu-system-arm -M vexpress-a9 -smp 1 -m 1G -nographic -semihosting -kernel <elf>
+
+	Notes:
+		- QEMU does not model caches or timing, the global timer counts the
+		  virtual clock.  With "-icount shift=0" it counts instructions, so
+		  results are repeatable
+		- With -semihosting, the application exit (_exit) also exits QEMU
+*/
+
+#ifndef TRU_BSP_QEMU_VEXPRESSA9_H
+#define TRU_BSP_QEMU_VEXPRESSA9_H
+
+#include "tru_config.h"
+
+#if(TRU_BOARD == TRU_BOARD_QEMU_VEXPRESSA9)
+
+#define TRU_QEMU_RAM_BASE   0x60000000UL
+#define TRU_QEMU_UART0_BASE 0x10009000UL  // PL011
+
+// Map to Arm defines
+#define TRU_PERIPH_BASE            0x1e000000UL
+#define TRU_L2C310_BASE            0x1e00a000UL
+#define TRU_L2C310_TAGRAM_LATENCY  0x0U
+#define TRU_L2C310_DATARAM_LATENCY 0x0U
+
+// QEMU's A9 global and private timers tick every 10ns (with prescaler 0)
+#define TRU_PERIPH_CLK_HZ 100000000U
+#define TRU_CPU_CLK_HZ    (TRU_PERIPH_CLK_HZ * 4U)  // Nominal only
+
+void tru_bsp_init(void);
+
+#endif
+
+#endif
@@ -0,0 +1,114 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Cyclone V SoC HPS ACP (Accelerator Coherency Port) ID Mapper and
+	coherent buffers.
+
+	FPGA masters that access the 1GB ACP window (0x80000000 - 0xbfffffff) of
+	the FPGA-to-HPS bridge go through the ACP to the SCU, which snoops the L1
+	data caches of the cores and then accesses the L2 cache.  A buffer that
+	is only accessed this way needs no cache maintenance before or after a
+	transfer, unlike a buffer in SDRAM (see tru_dma_sync_for_device() in
+	tru_cache.h).
+
+	The ACP ID Mapper maps the 12-bit AXI ID of a master to one of the
+	3-bit IDs of the ACP, and sets the AxUSER (shareability and cache
+	policy) and the 1GB page (address bits 31:30) of the accesses.  Virtual
+	IDs 2 to 6 can be mapped to a fixed master ID, all other masters use the
+	dynamic mapping.  tru_hps_acp_init() sets the dynamic mapping of reads
+	and writes to coherent accesses of the page of the .acp_buffer section,
+	which is enough for most FPGA DMA designs.  The mapper is shared by both
+	cores, so call it in one app only.
+
+	Buffers are allocated from the .acp_buffer section (cacheable, sized by
+	__ACP_BUFFER_SIZE in the linker file) with tru_hps_acp_alloc(), and the
+	FPGA master is given the bus address from tru_hps_acp_bus_addr().  All
+	buffers must be in the same 1GB page, which the section guarantees.
+
+	Requirements:
+		- the FPGA master must drive a cacheable AxCACHE (e.g. 0b1111)
+		- the core must participate in SMP coherency (TRU_CFG_SMP_COHERENCY =
+		  1U) with the SCU enabled (TRU_CFG_SCU = 1U), otherwise its L1 cache
+		  is not snooped
+		- the addresses are physical, the MMU setup maps flat (VA = PA)
+*/
+
+#ifndef TRU_C5SOC_HPS_ACP_LL_H
+#define TRU_C5SOC_HPS_ACP_LL_H
+
+#include "tru_config.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#include <stdint.h>
+
+// ACP ID Mapper base address
+#define TRU_HPS_ACPIDMAP_BASE 0xff707000UL
+
+// ACP ID Mapper registers, the read and write mapping of virtual IDs 2 to 6 and of the dynamic IDs
+#define TRU_HPS_ACPIDMAP_VID2RD   (TRU_HPS_ACPIDMAP_BASE + 0x00U)
+#define TRU_HPS_ACPIDMAP_VID2WR   (TRU_HPS_ACPIDMAP_BASE + 0x04U)
+#define TRU_HPS_ACPIDMAP_DYNRD    (TRU_HPS_ACPIDMAP_BASE + 0x28U)
+#define TRU_HPS_ACPIDMAP_DYNWR    (TRU_HPS_ACPIDMAP_BASE + 0x2cU)
+#define TRU_HPS_ACPIDMAP_VID2RD_S (TRU_HPS_ACPIDMAP_BASE + 0x30U)  // Status (mapping in use) registers follow the same order
+#define TRU_HPS_ACPIDMAP_VID2WR_S (TRU_HPS_ACPIDMAP_BASE + 0x34U)
+#define TRU_HPS_ACPIDMAP_STRIDE   8U  // Offset between the registers of two virtual IDs
+
+// Mapping register fields
+#define TRU_HPS_ACPIDMAP_USER_POS  4U
+#define TRU_HPS_ACPIDMAP_USER_MASK (0x1fU << TRU_HPS_ACPIDMAP_USER_POS)
+#define TRU_HPS_ACPIDMAP_PAGE_POS  12U
+#define TRU_HPS_ACPIDMAP_PAGE_MASK (0x3U << TRU_HPS_ACPIDMAP_PAGE_POS)
+#define TRU_HPS_ACPIDMAP_MID_POS   16U
+#define TRU_HPS_ACPIDMAP_MID_MASK  (0xfffU << TRU_HPS_ACPIDMAP_MID_POS)
+#define TRU_HPS_ACPIDMAP_FORCE     (1U << 31U)
+
+#define TRU_HPS_ACP_VID_MIN 2U
+#define TRU_HPS_ACP_VID_MAX 6U
+
+// AxUSER of a coherent access: shared (bit 0) and inner write-back write-allocate (bits 4:1)
+#define TRU_HPS_ACP_USER_COHERENT 0x1fU
+
+// ACP window as seen by the FPGA masters
+#define TRU_HPS_ACP_WINDOW_BASE 0x80000000UL
+#define TRU_HPS_ACP_WINDOW_SIZE 0x40000000UL
+
+// Places a variable in the .acp_buffer section
+#define TRU_ACP_BUFFER __attribute__((section(".acp_buffer"), aligned(32)))
+
+// Returns the address of a buffer in the ACP window, for an FPGA master
+static inline uint32_t tru_hps_acp_bus_addr(const void *buf){
+	return TRU_HPS_ACP_WINDOW_BASE | ((uint32_t)buf & (TRU_HPS_ACP_WINDOW_SIZE - 1U));
+}
+
+int32_t tru_hps_acp_map_fixed(uint32_t vid, uint32_t mid, uint32_t page, uint32_t user);
+void tru_hps_acp_map_dynamic(uint32_t page, uint32_t user);
+int32_t tru_hps_acp_init(void);
+void *tru_hps_acp_alloc(uint32_t size, uint32_t align);
+void tru_hps_acp_free_all(void);
+
+#endif
+
+#endif
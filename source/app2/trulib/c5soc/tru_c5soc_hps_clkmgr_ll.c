@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251207
+	Version: 20261019
 
 	Cyclone V SoC HPS Clock Manager.
 */
@@ -30,304 +30,304 @@
 
 #if(TRU_TARGET == TRU_TARGET_C5SOC)
 
-#include "tru_util_ll.h"
+#include "tru_iom.h"
 
 tru_hps_clk_t get_mpu_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t mpu_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		//.c = ((tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C0) & 0x1ff) + 1) * 2,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C0) & 0x1ff) + 1,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C0) & 0x1ff) + 1,
-		.fref = clk_in / mpu_base_clk.n,
-		.fvco = mpu_base_clk.fref * mpu_base_clk.m,
-		.fout = mpu_base_clk.fvco / (mpu_base_clk.c * mpu_base_clk.k)
+		//.c = ((iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C0) & 0x1ff) + 1) * 2,
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C0) & 0x1ff) + 1,
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C0) & 0x1ff) + 1
 	};
+	mpu_base_clk.fref = clk_in / mpu_base_clk.n;
+	mpu_base_clk.fvco = mpu_base_clk.fref * mpu_base_clk.m;
+	mpu_base_clk.fout = mpu_base_clk.fvco / (mpu_base_clk.c * mpu_base_clk.k);
 
 	return mpu_base_clk;
 }
 
 tru_hps_clk_t get_main_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t main_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		//.c = ((tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C1) & 0x1ff) + 1) * 4,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C1) & 0x1ff) + 1,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C1) & 0x1ff) + 1,
-		.fref = clk_in / main_base_clk.n,
-		.fvco = main_base_clk.fref * main_base_clk.m,
-		.fout = main_base_clk.fvco / (main_base_clk.c * main_base_clk.k)
+		//.c = ((iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C1) & 0x1ff) + 1) * 4,
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C1) & 0x1ff) + 1,
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C1) & 0x1ff) + 1
 	};
+	main_base_clk.fref = clk_in / main_base_clk.n;
+	main_base_clk.fvco = main_base_clk.fref * main_base_clk.m;
+	main_base_clk.fout = main_base_clk.fvco / (main_base_clk.c * main_base_clk.k);
 
 	return main_base_clk;
 }
 
 tru_hps_clk_t get_dbg_base_clk(float clk_in){
 
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t dbg_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		//.c = ((tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C2) & 0x1ff) + 1) * 4,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C2) & 0x1ff) + 1,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C2) & 0x1ff) + 1,
-		.fref = clk_in / dbg_base_clk.n,
-		.fvco = dbg_base_clk.fref * dbg_base_clk.m,
-		.fout = dbg_base_clk.fvco / (dbg_base_clk.c * dbg_base_clk.k)
+		//.c = ((iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C2) & 0x1ff) + 1) * 4,
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C2) & 0x1ff) + 1,
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C2) & 0x1ff) + 1
 	};
+	dbg_base_clk.fref = clk_in / dbg_base_clk.n;
+	dbg_base_clk.fvco = dbg_base_clk.fref * dbg_base_clk.m;
+	dbg_base_clk.fout = dbg_base_clk.fvco / (dbg_base_clk.c * dbg_base_clk.k);
 
 	return dbg_base_clk;
 }
 
 tru_hps_clk_t get_main_qspi_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t main_qspi_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C3) & 0x1ff) + 1,
-		.k = 1,
-		.fref = clk_in / main_qspi_base_clk.n,
-		.fvco = main_qspi_base_clk.fref * main_qspi_base_clk.m,
-		.fout = main_qspi_base_clk.fvco / (main_qspi_base_clk.c * main_qspi_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C3) & 0x1ff) + 1,
+		.k = 1
 	};
+	main_qspi_base_clk.fref = clk_in / main_qspi_base_clk.n;
+	main_qspi_base_clk.fvco = main_qspi_base_clk.fref * main_qspi_base_clk.m;
+	main_qspi_base_clk.fout = main_qspi_base_clk.fvco / (main_qspi_base_clk.c * main_qspi_base_clk.k);
 
 	return main_qspi_base_clk;
 }
 
 tru_hps_clk_t get_main_nand_sdmmc_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t main_nand_sdmmc_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C4) & 0x1ff) + 1,
-		.k = 1,
-		.fref = clk_in / main_nand_sdmmc_base_clk.n,
-		.fvco = main_nand_sdmmc_base_clk.fref * main_nand_sdmmc_base_clk.m,
-		.fout = main_nand_sdmmc_base_clk.fvco / (main_nand_sdmmc_base_clk.c * main_nand_sdmmc_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C4) & 0x1ff) + 1,
+		.k = 1
 	};
+	main_nand_sdmmc_base_clk.fref = clk_in / main_nand_sdmmc_base_clk.n;
+	main_nand_sdmmc_base_clk.fvco = main_nand_sdmmc_base_clk.fref * main_nand_sdmmc_base_clk.m;
+	main_nand_sdmmc_base_clk.fout = main_nand_sdmmc_base_clk.fvco / (main_nand_sdmmc_base_clk.c * main_nand_sdmmc_base_clk.k);
 
 	return main_nand_sdmmc_base_clk;
 }
 
 tru_hps_clk_t get_cfg_h2f_user0_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t cfg_h2f_user0_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C5) & 0x1ff) + 1,
-		.k = 1,
-		.fref = clk_in / cfg_h2f_user0_base_clk.n,
-		.fvco = cfg_h2f_user0_base_clk.fref * cfg_h2f_user0_base_clk.m,
-		.fout = cfg_h2f_user0_base_clk.fvco / (cfg_h2f_user0_base_clk.c * cfg_h2f_user0_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_C5) & 0x1ff) + 1,
+		.k = 1
 	};
+	cfg_h2f_user0_base_clk.fref = clk_in / cfg_h2f_user0_base_clk.n;
+	cfg_h2f_user0_base_clk.fvco = cfg_h2f_user0_base_clk.fref * cfg_h2f_user0_base_clk.m;
+	cfg_h2f_user0_base_clk.fout = cfg_h2f_user0_base_clk.fvco / (cfg_h2f_user0_base_clk.c * cfg_h2f_user0_base_clk.k);
 
 	return cfg_h2f_user0_base_clk;
 }
 
 tru_hps_clk_t get_emac0_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t emac0_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C0) & 0x1ff) + 1,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C0) & 0x1ff) + 1,
-		.fref = clk_in / emac0_base_clk.n,
-		.fvco = emac0_base_clk.fref * emac0_base_clk.m,
-		.fout = emac0_base_clk.fvco / (emac0_base_clk.c * emac0_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C0) & 0x1ff) + 1,
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C0) & 0x1ff) + 1
 	};
+	emac0_base_clk.fref = clk_in / emac0_base_clk.n;
+	emac0_base_clk.fvco = emac0_base_clk.fref * emac0_base_clk.m;
+	emac0_base_clk.fout = emac0_base_clk.fvco / (emac0_base_clk.c * emac0_base_clk.k);
 
 	return emac0_base_clk;
 }
 
 tru_hps_clk_t get_emac1_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t emac1_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C1) & 0x1ff) + 1,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C1) & 0x1ff) + 1,
-		.fref = clk_in / emac1_base_clk.n,
-		.fvco = emac1_base_clk.fref * emac1_base_clk.m,
-		.fout = emac1_base_clk.fvco / (emac1_base_clk.c * emac1_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C1) & 0x1ff) + 1,
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C1) & 0x1ff) + 1
 	};
+	emac1_base_clk.fref = clk_in / emac1_base_clk.n;
+	emac1_base_clk.fvco = emac1_base_clk.fref * emac1_base_clk.m;
+	emac1_base_clk.fout = emac1_base_clk.fvco / (emac1_base_clk.c * emac1_base_clk.k);
 
 	return emac1_base_clk;
 }
 
 tru_hps_clk_t get_peri_qspi_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t periph_qspi_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C2) & 0x1ff) + 1,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C2) & 0x1ff) + 1,
-		.fref = clk_in / periph_qspi_base_clk.n,
-		.fvco = periph_qspi_base_clk.fref * periph_qspi_base_clk.m,
-		.fout = periph_qspi_base_clk.fvco / (periph_qspi_base_clk.c * periph_qspi_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C2) & 0x1ff) + 1,
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C2) & 0x1ff) + 1
 	};
+	periph_qspi_base_clk.fref = clk_in / periph_qspi_base_clk.n;
+	periph_qspi_base_clk.fvco = periph_qspi_base_clk.fref * periph_qspi_base_clk.m;
+	periph_qspi_base_clk.fout = periph_qspi_base_clk.fvco / (periph_qspi_base_clk.c * periph_qspi_base_clk.k);
 
 	return periph_qspi_base_clk;
 }
 
 tru_hps_clk_t get_peri_nand_sdmmc_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t periph_nand_sdmmc_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C3) & 0x1ff) + 1,
-		.k = 1,
-		.fref = clk_in / periph_nand_sdmmc_base_clk.n,
-		.fvco = periph_nand_sdmmc_base_clk.fref * periph_nand_sdmmc_base_clk.m,
-		.fout = periph_nand_sdmmc_base_clk.fvco / (periph_nand_sdmmc_base_clk.c * periph_nand_sdmmc_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C3) & 0x1ff) + 1,
+		.k = 1
 	};
+	periph_nand_sdmmc_base_clk.fref = clk_in / periph_nand_sdmmc_base_clk.n;
+	periph_nand_sdmmc_base_clk.fvco = periph_nand_sdmmc_base_clk.fref * periph_nand_sdmmc_base_clk.m;
+	periph_nand_sdmmc_base_clk.fout = periph_nand_sdmmc_base_clk.fvco / (periph_nand_sdmmc_base_clk.c * periph_nand_sdmmc_base_clk.k);
 
 	return periph_nand_sdmmc_base_clk;
 }
 
 tru_hps_clk_t get_peri_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t periph_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C4) & 0x1ff) + 1,
-		.k = 1,
-		.fref = clk_in / periph_base_clk.n,
-		.fvco = periph_base_clk.fref * periph_base_clk.m,
-		.fout = periph_base_clk.fvco / (periph_base_clk.c * periph_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C4) & 0x1ff) + 1,
+		.k = 1
 	};
+	periph_base_clk.fref = clk_in / periph_base_clk.n;
+	periph_base_clk.fvco = periph_base_clk.fref * periph_base_clk.m;
+	periph_base_clk.fout = periph_base_clk.fvco / (periph_base_clk.c * periph_base_clk.k);
 
 	return periph_base_clk;
 }
 
 tru_hps_clk_t get_h2f_user1_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
 
 	tru_hps_clk_t h2f_user1_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
-		.c = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C5) & 0x1ff) + 1,
-		.k = 1,
-		.fref = clk_in / h2f_user1_base_clk.n,
-		.fvco = h2f_user1_base_clk.fref * h2f_user1_base_clk.m,
-		.fout = h2f_user1_base_clk.fvco / (h2f_user1_base_clk.c * h2f_user1_base_clk.k)
+		.c = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_C5) & 0x1ff) + 1,
+		.k = 1
 	};
+	h2f_user1_base_clk.fref = clk_in / h2f_user1_base_clk.n;
+	h2f_user1_base_clk.fvco = h2f_user1_base_clk.fref * h2f_user1_base_clk.m;
+	h2f_user1_base_clk.fout = h2f_user1_base_clk.fvco / (h2f_user1_base_clk.c * h2f_user1_base_clk.k);
 
 	return h2f_user1_base_clk;
 }
 
 tru_hps_clk_t get_ddr_dqs_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
-	uint32_t settings = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C0);
+	uint32_t settings = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C0);
 
 	tru_hps_clk_t ddr_dqs_base_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
 		.c = (settings & 0x1ff) + 1,
 		.phase = (settings >> 9 & 0xfff) * 45,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C0) & 0x1ff) + 1,
-		.fref = clk_in / ddr_dqs_base_clk.n,
-		.fvco = ddr_dqs_base_clk.fref * ddr_dqs_base_clk.m,
-		.fout = ddr_dqs_base_clk.fvco / (ddr_dqs_base_clk.c * ddr_dqs_base_clk.k)
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C0) & 0x1ff) + 1
 	};
+	ddr_dqs_base_clk.fref = clk_in / ddr_dqs_base_clk.n;
+	ddr_dqs_base_clk.fvco = ddr_dqs_base_clk.fref * ddr_dqs_base_clk.m;
+	ddr_dqs_base_clk.fout = ddr_dqs_base_clk.fvco / (ddr_dqs_base_clk.c * ddr_dqs_base_clk.k);
 
 	return ddr_dqs_base_clk;
 }
 
 tru_hps_clk_t get_ddr_2x_dqs_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
-	uint32_t settings = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C1);
+	uint32_t settings = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C1);
 
 	tru_hps_clk_t ddr_2x_dqs_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
 		.c = (settings & 0x1ff) + 1,
 		.phase = (settings >> 9 & 0xfff) * 45,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C1) & 0x1ff) + 1,
-		.fref = clk_in / ddr_2x_dqs_clk.n,
-		.fvco = ddr_2x_dqs_clk.fref * ddr_2x_dqs_clk.m,
-		.fout = ddr_2x_dqs_clk.fvco / (ddr_2x_dqs_clk.c * ddr_2x_dqs_clk.k)
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C1) & 0x1ff) + 1
 	};
+	ddr_2x_dqs_clk.fref = clk_in / ddr_2x_dqs_clk.n;
+	ddr_2x_dqs_clk.fvco = ddr_2x_dqs_clk.fref * ddr_2x_dqs_clk.m;
+	ddr_2x_dqs_clk.fout = ddr_2x_dqs_clk.fvco / (ddr_2x_dqs_clk.c * ddr_2x_dqs_clk.k);
 
 	return ddr_2x_dqs_clk;
 }
 
 tru_hps_clk_t get_ddr_dq_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
-	uint32_t settings = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C2);
+	uint32_t settings = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C2);
 
 	tru_hps_clk_t ddr_dq_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
 		.c = (settings & 0x1ff) + 1,
 		.phase = (settings >> 9 & 0xfff) * 45,
-		.k = (tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C2) & 0x1ff) + 1,
-		.fref = clk_in / ddr_dq_clk.n,
-		.fvco = ddr_dq_clk.fref * ddr_dq_clk.m,
-		.fout = ddr_dq_clk.fvco / (ddr_dq_clk.c * ddr_dq_clk.k)
+		.k = (iom_rd32((uint32_t *)TRU_HPS_CLKMGR_ALTERA_K_C2) & 0x1ff) + 1
 	};
+	ddr_dq_clk.fref = clk_in / ddr_dq_clk.n;
+	ddr_dq_clk.fvco = ddr_dq_clk.fref * ddr_dq_clk.m;
+	ddr_dq_clk.fout = ddr_dq_clk.fvco / (ddr_dq_clk.c * ddr_dq_clk.k);
 
 	return ddr_dq_clk;
 }
 
 tru_hps_clk_t get_h2f_user2_base_clk(float clk_in){
-	uint32_t vco = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
+	uint32_t vco = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_VCO);  // Read VCO register
 	uint32_t denom = vco >> 16 & 0x3f;
 	uint32_t numer = vco >> 3 & 0xfff;
-	uint32_t settings = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C5);
+	uint32_t settings = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_SDRAMPLL_C5);
 
 	tru_hps_clk_t h2f_user2_clk = {
 		.n = denom + 1,
 		.m = numer + 1,
 		.c = (settings & 0x1ff) + 1,
 		.phase = (settings >> 9 & 0xfff) * 45,
-		.k = 1,
-		.fref = clk_in / h2f_user2_clk.n,
-		.fvco = h2f_user2_clk.fref * h2f_user2_clk.m,
-		.fout = h2f_user2_clk.fvco / (h2f_user2_clk.c * h2f_user2_clk.k)
+		.k = 1
 	};
+	h2f_user2_clk.fref = clk_in / h2f_user2_clk.n;
+	h2f_user2_clk.fvco = h2f_user2_clk.fref * h2f_user2_clk.m;
+	h2f_user2_clk.fout = h2f_user2_clk.fvco / (h2f_user2_clk.c * h2f_user2_clk.k);
 
 	return h2f_user2_clk;
 }
@@ -353,7 +353,7 @@ tru_hps_clk_t get_l3_main_clk(float clk_in){
 }
 
 tru_hps_clk_t get_dbg_at_clk(float clk_in){
-	uint32_t dbgatclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_DBGDIV) & 0x3;
+	uint32_t dbgatclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_DBGDIV) & 0x3;
 	dbgatclkdiv = (dbgatclkdiv == 0) ? 1 : 2 << (dbgatclkdiv - 1);
 
 	tru_hps_clk_t dbg_at_clk = get_dbg_base_clk(clk_in);
@@ -363,7 +363,7 @@ tru_hps_clk_t get_dbg_at_clk(float clk_in){
 }
 
 tru_hps_clk_t get_dbg_clk(float clk_in){
-	uint32_t div = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_DBGDIV);
+	uint32_t div = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_DBGDIV);
 
 	uint32_t dbgatclkdiv = div & 0x3;
 	dbgatclkdiv = (dbgatclkdiv == 0) ? 1 : 2 << (dbgatclkdiv - 1);
@@ -379,7 +379,7 @@ tru_hps_clk_t get_dbg_clk(float clk_in){
 }
 
 tru_hps_clk_t get_dbg_trace_clk(float clk_in){
-	uint32_t traceclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_TRACEDIV) & 0x7;
+	uint32_t traceclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_TRACEDIV) & 0x7;
 	traceclkdiv = (traceclkdiv == 0) ? 1 : 2 << (traceclkdiv - 1);
 
 	tru_hps_clk_t dbg_trace_clk = get_dbg_base_clk(clk_in);
@@ -401,7 +401,7 @@ tru_hps_clk_t get_h2f_user0_clk(float clk_in){
 }
 
 tru_hps_clk_t get_l3_mp_clk(float clk_in){
-	uint32_t l3mpclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV) & 0x3;
+	uint32_t l3mpclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV) & 0x3;
 	l3mpclkdiv = (l3mpclkdiv == 0) ? 1 : 2 << (l3mpclkdiv - 1);
 
 	tru_hps_clk_t l3_mp_clk = get_main_base_clk(clk_in);
@@ -411,7 +411,7 @@ tru_hps_clk_t get_l3_mp_clk(float clk_in){
 }
 
 tru_hps_clk_t get_l3_sp_clk(float clk_in){
-	uint32_t div = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV);
+	uint32_t div = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV);
 
 	uint32_t l3mpclkdiv =div & 0x3;
 	l3mpclkdiv = (l3mpclkdiv == 0) ? 1 : 2 << (l3mpclkdiv - 1);
@@ -426,10 +426,10 @@ tru_hps_clk_t get_l3_sp_clk(float clk_in){
 }
 
 tru_hps_clk_t get_l4_mp_clk(float clk_in){
-	uint32_t l4mpclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV) >> 4 & 0x7;
+	uint32_t l4mpclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV) >> 4 & 0x7;
 	l4mpclkdiv = (l4mpclkdiv == 0) ? 1 : 2 << (l4mpclkdiv - 1);
 
-	uint32_t l4src = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_L4SRC);
+	uint32_t l4src = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_L4SRC);
 
 	tru_hps_clk_t l4_mp_clk;
 	l4_mp_clk = (l4src & 0x1) ? get_peri_base_clk(clk_in) : get_main_base_clk(clk_in);
@@ -439,10 +439,10 @@ tru_hps_clk_t get_l4_mp_clk(float clk_in){
 }
 
 tru_hps_clk_t get_l4_sp_clk(float clk_in){
-	uint32_t l4spclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV) >> 7 & 0x7;
+	uint32_t l4spclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_MAINDIV) >> 7 & 0x7;
 	l4spclkdiv = (l4spclkdiv == 0) ? 1 : 2 << (l4spclkdiv - 1);
 
-	uint32_t l4src = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_L4SRC);
+	uint32_t l4src = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_MAINPLL_L4SRC);
 
 	tru_hps_clk_t l4_sp_clk;
 	l4_sp_clk = (l4src >> 1 & 0x1) ? get_peri_base_clk(clk_in) : get_main_base_clk(clk_in);
@@ -460,7 +460,7 @@ tru_hps_clk_t get_emac1_clk(float clk_in){
 }
 
 tru_hps_clk_t get_usb_mp_clk(float clk_in){
-	uint32_t usbclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) & 0x7;
+	uint32_t usbclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) & 0x7;
 	usbclkdiv = (usbclkdiv == 0) ? 1 : 2 << (usbclkdiv - 1);
 
 	tru_hps_clk_t usb_mp_clk = get_peri_base_clk(clk_in);
@@ -470,7 +470,7 @@ tru_hps_clk_t get_usb_mp_clk(float clk_in){
 }
 
 tru_hps_clk_t get_spi_m_clk(float clk_in){
-	uint32_t spimclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) >> 3 & 0x7;
+	uint32_t spimclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) >> 3 & 0x7;
 	spimclkdiv = (spimclkdiv == 0) ? 1 : 2 << (spimclkdiv - 1);
 
 	tru_hps_clk_t spi_m_clk = get_peri_base_clk(clk_in);
@@ -480,7 +480,7 @@ tru_hps_clk_t get_spi_m_clk(float clk_in){
 }
 
 tru_hps_clk_t get_can0_clk(float clk_in){
-	uint32_t can0clkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) >> 6 & 0x7;
+	uint32_t can0clkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) >> 6 & 0x7;
 	can0clkdiv = (can0clkdiv == 0) ? 1 : 2 << (can0clkdiv - 1);
 
 	tru_hps_clk_t can0_clk = get_peri_base_clk(clk_in);
@@ -490,7 +490,7 @@ tru_hps_clk_t get_can0_clk(float clk_in){
 }
 
 tru_hps_clk_t get_can1_clk(float clk_in){
-	uint32_t can1clkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) >> 9 & 0x7;
+	uint32_t can1clkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_DIV) >> 9 & 0x7;
 	can1clkdiv = (can1clkdiv == 0) ? 1 : 2 << (can1clkdiv - 1);
 
 	tru_hps_clk_t can1_clk = get_peri_base_clk(clk_in);
@@ -500,7 +500,7 @@ tru_hps_clk_t get_can1_clk(float clk_in){
 }
 
 tru_hps_clk_t get_gpio_db_clk(float clk_in){
-	uint32_t gpiodbclkdiv = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_GPIODIV) & 0xffffff;
+	uint32_t gpiodbclkdiv = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_GPIODIV) & 0xffffff;
 
 	tru_hps_clk_t gpio_db_clk = get_peri_base_clk(clk_in);
 	gpio_db_clk.fout = gpio_db_clk.fout / gpiodbclkdiv;
@@ -513,7 +513,7 @@ tru_hps_clk_t get_h2f_user1_clk(float clk_in){
 }
 
 tru_hps_clk_t get_sdmmc_clk(float clk_in){
-	uint32_t src = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_SRC);
+	uint32_t src = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_SRC);
 
 	tru_hps_clk_t sdmmc_clk = {
 		.n = 0,
@@ -536,7 +536,7 @@ tru_hps_clk_t get_sdmmc_clk(float clk_in){
 }
 
 tru_hps_clk_t get_nand_x_clk(float clk_in){
-	uint32_t src = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_SRC);
+	uint32_t src = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_SRC);
 
 	tru_hps_clk_t nand_x_clk = {
 		.n = 0,
@@ -566,7 +566,7 @@ tru_hps_clk_t get_nand_clk(float clk_in){
 }
 
 tru_hps_clk_t get_qspi_clk(float clk_in){
-	uint32_t src = tru_iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_SRC);
+	uint32_t src = iom_rd32((uint32_t *)TRU_HPS_CLKMGR_PERIPLL_SRC);
 
 	tru_hps_clk_t qspi_clk = {
 		.n = 0,
@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20250405
+	Version: 20261019
 
 	Low-level code for Cyclone V SoC HPS UART controller.
 */
@@ -35,6 +35,7 @@
 
 #include "tru_iom.h"
 #include <stdint.h>
+#include <stdbool.h>
 
 // ======================================================================
 // Intel Cyclone V SoC FPGA (Synopsys UART controller) specific registers
@@ -45,6 +46,7 @@
 #define TRU_HPS_UART_LSR_OFFSET         0x14U
 #define TRU_HPS_UART_SFE_OFFSET         0x98U
 #define TRU_HPS_UART_STET_OFFSET        0xa0U
+#define TRU_HPS_UART_LSR_DR_SET_MSK     0x00000001UL
 #define TRU_HPS_UART_LSR_TEMT_SET_MSK   0x00000040UL
 #define TRU_HPS_UART_LSR_THRE_SET_MSK   0x00000020UL
 
@@ -101,7 +103,21 @@ typedef struct{
 #define TRU_HPS_UART1_REG ((volatile tru_hps_uart_reg_t *const)TRU_HPS_UART1_BASE)
 #define TRU_HPS_UART_REG(base_addr) ((volatile tru_hps_uart_reg_t *const)base_addr)
 
+// Register access through iom_rd32/iom_wr32, so that the host build can simulate the UART controller
+static inline uint32_t tru_hps_uart_ll_rd(void *uart_base, uint32_t offset){
+	return iom_rd32((uint32_t *)((uintptr_t)uart_base + offset));
+}
+
+static inline void tru_hps_uart_ll_wr(void *uart_base, uint32_t offset, uint32_t val){
+	iom_wr32((uint32_t *)((uintptr_t)uart_base + offset), val);
+}
+
+bool tru_hps_uart_ll_is_empty(void *uart_base);
+bool tru_hps_uart_ll_is_fifo_th_en(void *uart_base);
+bool tru_hps_uart_ll_is_ready(void *uart_base, char fifo_th_en);
+bool tru_hps_uart_ll_is_rx_ready(void *uart_base);
 void tru_hps_uart_ll_wait_empty(void *uart_base);
+void tru_hps_uart_ll_wait_ready(void *uart_base, char fifo_th_en);
 void tru_hps_uart_ll_write_str(void *uart_base, const char *str, uint32_t len);
 void tru_hps_uart_ll_write_char(void *uart_base, const char c);
 void tru_hps_uart_ll_write_hex_nibble(void *uart_base, unsigned char nibble);
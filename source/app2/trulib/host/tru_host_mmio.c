@@ -0,0 +1,138 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Simulated memory-mapped registers for the host build.
+*/
+
+#include "tru_config.h"
+#include "tru_host_mmio.h"
+
+#if(TRU_CPU_FAMILY == TRU_CPU_FAMILY_HOST)
+
+#include <stdlib.h>
+
+typedef struct{
+	uintptr_t base;
+	size_t size;
+	uint32_t *mem;
+}mmio_block_t;
+
+typedef struct{
+	uintptr_t addr;
+	tru_host_mmio_rd_t rd;
+	tru_host_mmio_wr_t wr;
+	void *ctx;
+}mmio_hook_t;
+
+static mmio_block_t blocks[TRU_HOST_MMIO_BLOCKS_MAX];
+static uint32_t num_blocks;
+static mmio_hook_t hooks[TRU_HOST_MMIO_HOOKS_MAX];
+static uint32_t num_hooks;
+
+static mmio_block_t *find_block(uintptr_t addr){
+	for(uint32_t i = 0U; i < num_blocks; i++){
+		if(addr >= blocks[i].base && addr - blocks[i].base < blocks[i].size) return &blocks[i];
+	}
+	return NULL;
+}
+
+static mmio_hook_t *find_hook(uintptr_t addr){
+	for(uint32_t i = 0U; i < num_hooks; i++){
+		if(hooks[i].addr == addr) return &hooks[i];
+	}
+	return NULL;
+}
+
+// Maps a zero filled register block at the target address.  Returns -1 if there is no free block, it overlaps or out of memory
+int32_t tru_host_mmio_map(uintptr_t base, size_t size){
+	if(num_blocks >= TRU_HOST_MMIO_BLOCKS_MAX || size == 0U) return -1;
+	for(uint32_t i = 0U; i < num_blocks; i++){
+		if(base < blocks[i].base + blocks[i].size && blocks[i].base < base + size) return -1;  // Overlaps
+	}
+
+	uint32_t *mem = calloc((size + 3U) / 4U, sizeof(uint32_t));
+	if(mem == NULL) return -1;
+
+	blocks[num_blocks].base = base;
+	blocks[num_blocks].size = size;
+	blocks[num_blocks].mem = mem;
+	num_blocks++;
+	return 0;
+}
+
+// Adds read and/or write callbacks to a mapped register.  Returns -1 if the register is not mapped or there is no free hook
+int32_t tru_host_mmio_hook(uintptr_t addr, tru_host_mmio_rd_t rd, tru_host_mmio_wr_t wr, void *ctx){
+	if(find_block(addr) == NULL) return -1;
+
+	mmio_hook_t *hook = find_hook(addr);
+	if(hook == NULL){
+		if(num_hooks >= TRU_HOST_MMIO_HOOKS_MAX) return -1;
+		hook = &hooks[num_hooks++];
+	}
+
+	hook->addr = addr;
+	hook->rd = rd;
+	hook->wr = wr;
+	hook->ctx = ctx;
+	return 0;
+}
+
+void tru_host_mmio_unmap_all(void){
+	for(uint32_t i = 0U; i < num_blocks; i++){
+		free(blocks[i].mem);
+	}
+	num_blocks = 0U;
+	num_hooks = 0U;
+}
+
+// Returns the simulated memory of a register, for setting up initial values.  NULL if not mapped
+uint32_t *tru_host_mmio_ptr(uintptr_t addr){
+	mmio_block_t *block = find_block(addr);
+	if(block == NULL) return NULL;
+	return &block->mem[(addr - block->base) / 4U];
+}
+
+uint32_t tru_host_mmio_rd32(uintptr_t addr){
+	uint32_t *reg = tru_host_mmio_ptr(addr);
+	if(reg == NULL) return *(volatile uint32_t *)addr;  // Ordinary memory
+
+	mmio_hook_t *hook = find_hook(addr);
+	if(hook && hook->rd) return hook->rd(hook->ctx, addr, *reg);
+	return *reg;
+}
+
+void tru_host_mmio_wr32(uintptr_t addr, uint32_t val){
+	uint32_t *reg = tru_host_mmio_ptr(addr);
+	if(reg == NULL){
+		*(volatile uint32_t *)addr = val;  // Ordinary memory
+		return;
+	}
+
+	*reg = val;
+	mmio_hook_t *hook = find_hook(addr);
+	if(hook && hook->wr) hook->wr(hook->ctx, addr, val);
+}
+
+#endif
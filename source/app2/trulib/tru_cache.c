@@ -0,0 +1,368 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Size-adaptive cache maintenance and DMA sync.
+
+	The range operations cost time per cache line, the whole cache
+	operations cost about the same time whatever the range, so above some
+	range size the whole cache operation is cheaper.  The thresholds are
+	measured by timing both on a buffer with the global timer.
+*/
+
+#include "tru_cache.h"
+
+#if(TRU_TARGET == TRU_TARGET_C5SOC)
+
+#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U)
+
+#include "arm/tru_cortex_a9.h"
+#include "tru_iom.h"
+#include <string.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#define CALIB_SIZE (16U * 1024U)  // Fits in the L1 cache
+
+// Defaults until calibrated: twice the cache size (32KB L1, 512KB L2)
+tru_cache_thresholds_t tru_cache_thresholds = {
+	.l1 = 64U * 1024U,
+#if defined(TRU_CACHE_L2_WAY_OPS) && TRU_CACHE_L2_WAY_OPS == 1U
+	.l2 = 1024U * 1024U
+#else
+	.l2 = UINT32_MAX
+#endif
+};
+
+static uint8_t calib_buf[CALIB_SIZE] __attribute__((aligned(32)));
+
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U && defined(TRU_CACHE_L2_WAY_OPS) && TRU_CACHE_L2_WAY_OPS == 1U
+// Runs a by-way operation on all ways except the excluded (pinned) ways and waits for it.  No other L2 maintenance is allowed while it is in progress,
+// by this core (IRQs are masked) or by the other core (the lock)
+static void l2_all_by_way(volatile uint32_t *reg, uint32_t exclude){
+	uint32_t mask = ((L2C_310->AUX_CNT & (1U << 16U)) ? 0xffffU : 0xffU) & ~exclude;  // 16 or 8 ways
+	uint32_t cpsr = tru_l2c310_lock();
+
+	*reg = mask;
+	while(*reg & mask);  // The bits clear when done
+	L2C_Sync();
+	__DSB();
+	tru_l2c310_unlock(cpsr);
+}
+#endif
+
+// Returns the threshold from the time of a CALIB_SIZE range operation and of the whole cache operation
+static uint32_t calc_threshold(uint32_t range_ticks, uint32_t all_ticks){
+	if(range_ticks == 0U) return UINT32_MAX;
+
+	uint64_t threshold = (uint64_t)all_ticks * CALIB_SIZE / range_ticks;
+	return (threshold > UINT32_MAX) ? UINT32_MAX : (uint32_t)threshold;
+}
+
+// Measures the thresholds, call once after the caches are enabled.  It takes about as long as cleaning both caches a few times
+void tru_cache_calibrate(void){
+	uint32_t cpsr = tru_irq_save();
+	uint32_t start;
+	uint32_t range_ticks;
+	uint32_t all_ticks;
+
+	if(!gtim_is_enabled()) gtim_enable();
+
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	memset(calib_buf, 1, CALIB_SIZE);  // Dirty lines, as the range to clean usually has
+	start = gtim_get_counter_low();
+	tru_l1_data_clean_range(calib_buf, CALIB_SIZE);
+	range_ticks = gtim_get_counter_low() - start;
+
+	memset(calib_buf, 2, CALIB_SIZE);
+	start = gtim_get_counter_low();
+	L1C_CleanDCacheAll();
+	__DSB();
+	all_ticks = gtim_get_counter_low() - start;
+
+	tru_cache_thresholds.l1 = calc_threshold(range_ticks, all_ticks);
+#endif
+
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U && defined(TRU_CACHE_L2_WAY_OPS) && TRU_CACHE_L2_WAY_OPS == 1U
+	start = gtim_get_counter_low();
+	tru_l2_data_clean_range(calib_buf, CALIB_SIZE);  // The lines are in L2 after the L1 clean above
+	range_ticks = gtim_get_counter_low() - start;
+
+	memset(calib_buf, 3, CALIB_SIZE);
+	tru_l1_data_clean_range(calib_buf, CALIB_SIZE);  // Dirty the lines in L2 again, the range clean above cleaned them
+	start = gtim_get_counter_low();
+	l2_all_by_way(&L2C_310->CLEAN_WAY, 0U);
+	all_ticks = gtim_get_counter_low() - start;
+
+	tru_cache_thresholds.l2 = calc_threshold(range_ticks, all_ticks);
+#endif
+
+	tru_irq_restore(cpsr);
+}
+
+// Prints the build settings (0 = off, 1 = on, 2 = left as the boot loader set it) and the state read back from the
+// hardware, followed by a warning if a cache or the MMU is off, because then every access goes to SDRAM:
+//   CACHECFG l1_cfg=<n> l2_cfg=<n> mmu_cfg=<n> smp_cfg=<n> mmu=<n> icache=<n> dcache=<n> bpred=<n> smp=<n> scu=<n> l2=<n> l2_prefetch=0x<value>
+void tru_cache_print_config(void){
+#if defined(TRU_L1_CACHE)
+	uint32_t l1_cfg = TRU_L1_CACHE;
+#else
+	uint32_t l1_cfg = 2U;
+#endif
+#if defined(TRU_L2_CACHE)
+	uint32_t l2_cfg = TRU_L2_CACHE;
+#else
+	uint32_t l2_cfg = 2U;
+#endif
+#if defined(TRU_MMU)
+	uint32_t mmu_cfg = TRU_MMU;
+#else
+	uint32_t mmu_cfg = 2U;
+#endif
+#if defined(TRU_SMP_COHERENCY)
+	uint32_t smp_cfg = TRU_SMP_COHERENCY;
+#else
+	uint32_t smp_cfg = 2U;
+#endif
+	uint32_t sctlr = __get_SCTLR();
+	uint32_t mmu = (sctlr & SCTLR_M_Msk) ? 1U : 0U;
+	uint32_t dcache = (sctlr & SCTLR_C_Msk) ? 1U : 0U;
+	uint32_t l2 = L2C_310->CONTROL & 0x1U;
+
+	printf("CACHECFG l1_cfg=%" PRIu32 " l2_cfg=%" PRIu32 " mmu_cfg=%" PRIu32 " smp_cfg=%" PRIu32 " mmu=%" PRIu32 " icache=%" PRIu32 " dcache=%" PRIu32 " bpred=%" PRIu32 " smp=%" PRIu32 " scu=%" PRIu32 " l2=%" PRIu32 " l2_prefetch=0x%08" PRIx32 "\n",
+		l1_cfg, l2_cfg, mmu_cfg, smp_cfg, mmu,
+		(sctlr & SCTLR_I_Msk) ? 1U : 0U,
+		dcache,
+		(sctlr & SCTLR_Z_Msk) ? 1U : 0U,
+		(__get_ACTLR() >> 6U) & 0x1U,  // SMP bit
+		iom_rd32((uint32_t *)SCU_BASE) & 0x1U,
+		l2,
+		tru_l2c310_get_prefetch()
+	);
+	if(!mmu || !dcache || !l2){
+		printf("CACHECFG warning: %s%s%sis off, expect much lower performance\n", mmu ? "" : "MMU ", dcache ? "" : "L1 D-cache ", l2 ? "" : "L2 cache ");
+	}
+}
+
+// Clean (write back) a range, e.g. before a device reads it.  L1 first, then L2
+void tru_cache_data_clean_range(void *buf, uint32_t len){
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	if(len >= tru_cache_thresholds.l1){
+		L1C_CleanDCacheAll();
+		__DSB();
+	}else{
+		tru_l1_data_clean_range(buf, len);
+	}
+#endif
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+#if defined(TRU_CACHE_L2_WAY_OPS) && TRU_CACHE_L2_WAY_OPS == 1U
+	if(len >= tru_cache_thresholds.l2){
+		l2_all_by_way(&L2C_310->CLEAN_WAY, 0U);
+	}else{
+		tru_l2_data_clean_range(buf, len);
+	}
+#else
+	tru_l2_data_clean_range(buf, len);
+#endif
+#endif
+}
+
+// Invalidate a range, e.g. after a device wrote to it.  L2 first, then L1, so L1 cannot refill from stale L2 lines.
+// See tru_cache.h for the condition of the whole cache operation
+void tru_cache_data_inv_range(void *buf, uint32_t len){
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+#if defined(TRU_CACHE_L2_WAY_OPS) && TRU_CACHE_L2_WAY_OPS == 1U
+	if(len >= tru_cache_thresholds.l2){
+		l2_all_by_way(&L2C_310->CLEAN_INV_WAY, tru_l2c310_pinned_ways);  // Invalidate alone would discard the dirty lines of everything else
+	}else{
+		tru_l2_data_inv_range(buf, len);
+	}
+#else
+	tru_l2_data_inv_range(buf, len);
+#endif
+#endif
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	if(len >= tru_cache_thresholds.l1){
+		L1C_CleanInvalidateDCacheAll();  // Invalidate alone would discard the dirty lines of everything else
+		__DSB();
+	}else{
+		tru_l1_data_inv_range(buf, len);
+	}
+#endif
+}
+
+// Clean and invalidate a range.  L1 first, then L2
+void tru_cache_data_cleaninv_range(void *buf, uint32_t len){
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+	if(len >= tru_cache_thresholds.l1){
+		L1C_CleanInvalidateDCacheAll();
+		__DSB();
+	}else{
+		tru_l1_data_cleaninv_range(buf, len);
+	}
+#endif
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+#if defined(TRU_CACHE_L2_WAY_OPS) && TRU_CACHE_L2_WAY_OPS == 1U
+	if(len >= tru_cache_thresholds.l2){
+		l2_all_by_way(&L2C_310->CLEAN_INV_WAY, tru_l2c310_pinned_ways);  // The pinned lines must stay
+	}else{
+		tru_l2_data_cleaninv_range(buf, len);
+	}
+#else
+	tru_l2_data_cleaninv_range(buf, len);
+#endif
+#endif
+}
+
+// ========
+// DMA sync
+// ========
+
+typedef enum{
+	DMA_OP_CLEAN = 0,
+	DMA_OP_INV,
+	DMA_OP_CLEANINV
+}dma_op_t;
+
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+// The MVA operations are ordered with each other, so there is no barrier per line (unlike the CMSIS functions)
+static inline void dma_l1_range(uint32_t addr, uint32_t limit, uint32_t start, uint32_t end, dma_op_t op){
+	for(; addr < limit; addr += CACHELINE_SIZE){
+		if(op == DMA_OP_CLEAN){
+			__set_DCCMVAC(addr);
+		}else if(op == DMA_OP_INV && addr >= start && addr + CACHELINE_SIZE <= end){
+			__set_DCIMVAC(addr);
+		}else{
+			__set_DCCIMVAC(addr);  // Also a partial line at an edge
+		}
+	}
+}
+#endif
+
+#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+static inline void dma_l2_range(uint32_t addr, uint32_t limit, uint32_t start, uint32_t end, dma_op_t op){
+	for(; addr < limit; addr += CACHELINE_SIZE){
+		if(op == DMA_OP_CLEAN){
+			L2C_310->CLEAN_LINE_PA = addr;
+		}else if(op == DMA_OP_INV && addr >= start && addr + CACHELINE_SIZE <= end){
+			L2C_310->INV_LINE_PA = addr;
+		}else{
+			L2C_310->CLEAN_INV_LINE_PA = addr;  // Also a partial line at an edge
+		}
+	}
+}
+#endif
+
+// One pass over the range, in chunks.  Clean: L1 then L2.  Invalidate: L2 then L1 (l2_first)
+static void dma_sync_range(void *buf, uint32_t len, dma_op_t op, bool l2_first){
+	uint32_t start = (uint32_t)buf;
+	uint32_t end = start + len;
+	uint32_t addr = start & ~(CACHELINE_SIZE - 1U);
+
+	if(len == 0U) return;
+
+	while(addr < end){
+		uint32_t limit = (addr & ~(TRU_DMA_SYNC_CHUNK_SIZE - 1U)) + TRU_DMA_SYNC_CHUNK_SIZE;
+		if(limit > end || limit < addr) limit = end;  // Last chunk, or wrapped around at 4GB
+
+#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U && defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
+		uint32_t cpsr = tru_l2c310_lock();  // Per chunk, to limit the time with IRQs masked
+		if(l2_first){
+			dma_l2_range(addr, limit, start, end, op);
+			L2C_Sync();
+			__DSB();  // Ensure L2 has dropped the lines, before L1 can refill from it
+			dma_l1_range(addr, limit, start, end, op);
+		}else{
+			dma_l1_range(addr, limit, start, end, op);
+			__DSB();  // Ensure the L1 write-backs have reached L2 before it cleans
+			dma_l2_range(addr, limit, start, end, op);
+			L2C_Sync();
+		}
+		tru_l2c310_unlock(cpsr);
+#elif defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U
+		(void)l2_first;
+		dma_l1_range(addr, limit, start, end, op);
+#else
+		(void)l2_first;
+		uint32_t cpsr = tru_l2c310_lock();
+		dma_l2_range(addr, limit, start, end, op);
+		L2C_Sync();
+		tru_l2c310_unlock(cpsr);
+#endif
+
+		addr = (limit + CACHELINE_SIZE - 1U) & ~(CACHELINE_SIZE - 1U);
+		if(addr == 0U) break;  // Wrapped around at 4GB
+	}
+
+	__DSB();  // Ensure completion, the L2 operations were synced per chunk
+}
+
+// Returns true if the range is above the thresholds of both cache levels, where the size-adaptive functions are cheaper
+static inline bool dma_use_whole(uint32_t len){
+	return len >= tru_cache_thresholds.l1 && len >= tru_cache_thresholds.l2;
+}
+
+// Call before starting a transfer
+void tru_dma_sync_for_device(void *buf, uint32_t len, tru_dma_dir_t dir){
+	switch(dir){
+		case TRU_DMA_TO_DEVICE:
+			if(dma_use_whole(len)){
+				tru_cache_data_clean_range(buf, len);
+			}else{
+				dma_sync_range(buf, len, DMA_OP_CLEAN, false);
+			}
+			break;
+		case TRU_DMA_FROM_DEVICE:
+			// Drop the lines, so no dirty line can be evicted over the device data during the transfer
+			if(dma_use_whole(len)){
+				tru_cache_data_cleaninv_range(buf, len);
+			}else{
+				dma_sync_range(buf, len, DMA_OP_INV, false);
+			}
+			break;
+		default:
+			if(dma_use_whole(len)){
+				tru_cache_data_cleaninv_range(buf, len);
+			}else{
+				dma_sync_range(buf, len, DMA_OP_CLEANINV, false);
+			}
+			break;
+	}
+}
+
+// Call after a transfer has completed, before the CPU reads the buffer
+void tru_dma_sync_for_cpu(void *buf, uint32_t len, tru_dma_dir_t dir){
+	if(dir == TRU_DMA_TO_DEVICE) return;  // The buffer was not changed
+
+	// Drop the lines speculatively loaded during the transfer
+	if(dma_use_whole(len)){
+		tru_cache_data_inv_range(buf, len);
+	}else{
+		dma_sync_range(buf, len, DMA_OP_INV, true);
+	}
+}
+
+#endif
+
+#endif
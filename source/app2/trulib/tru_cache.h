@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251206
+	Version: 20261019
 */
 
 #ifndef TRU_CACHE_H
@@ -95,6 +95,10 @@ static inline void tru_l1_data_cleaninv_range(void *buf, uint32_t len){
 
 #if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U
 
+// The range operations write the PA registers for every line and issue a single cache sync at the end,
+// instead of the CMSIS L2C_CleanPa() etc. which issue a sync for every line.  They hold the L2 maintenance
+// lock (see arm/tru_cache_l2c310.h), so they cannot overlap with a by-way operation of either core
+
 static inline bool tru_l2_is_enabled(void){
 	return L2C_310->CONTROL & 0x1U;
 }
@@ -102,38 +106,106 @@ static inline bool tru_l2_is_enabled(void){
 static inline void tru_l2_data_clean_range(void *buf, uint32_t len){
 	uint32_t limit = (uint32_t)buf + len;
 	uint32_t addr = (uint32_t)buf & ~(CACHELINE_SIZE - 1U);
+	uint32_t cpsr = tru_l2c310_lock();
 
 	while(addr < limit){
-		L2C_CleanPa((void *)addr);  // Note, this also issues the L2 sync instruction, which will stall the slave port until completion, that is unless there is a L2 background operation in in progress
+		L2C_310->CLEAN_LINE_PA = addr;  // The line operations are blocking, so they can be written back to back
 		addr += CACHELINE_SIZE;  // Increment index
 	}
+	L2C_Sync();  // One sync for the whole range, it stalls the slave port until the buffers are drained
 	__DSB();
+	tru_l2c310_unlock(cpsr);
 }
 
 static inline void tru_l2_data_inv_range(void *buf, uint32_t len){
 	uint32_t limit = (uint32_t)buf + len;
 	uint32_t addr = (uint32_t)buf & ~(CACHELINE_SIZE - 1U);
+	uint32_t cpsr = tru_l2c310_lock();
 
 	while(addr < limit){
-		L2C_InvPa((void *)addr);  // Note, this also issues the L2 sync instruction, which will stall the slave port until completion, that is unless there is a L2 background operation in in progress
+		L2C_310->INV_LINE_PA = addr;  // The line operations are blocking, so they can be written back to back
 		addr += CACHELINE_SIZE;  // Increment index
 	}
+	L2C_Sync();  // One sync for the whole range, it stalls the slave port until the buffers are drained
 	__DSB();
+	tru_l2c310_unlock(cpsr);
 }
 
 static inline void tru_l2_data_cleaninv_range(void *buf, uint32_t len){
 	uint32_t limit = (uint32_t)buf + len;
 	uint32_t addr = (uint32_t)buf & ~(CACHELINE_SIZE - 1U);
+	uint32_t cpsr = tru_l2c310_lock();
 
 	while(addr < limit){
-		L2C_CleanInvPa((void *)addr);  // Note, this also issues the L2 sync instruction, which will stall the slave port until completion, that is unless there is a L2 background operation in in progress
+		L2C_310->CLEAN_INV_LINE_PA = addr;  // The line operations are blocking, so they can be written back to back
 		addr += CACHELINE_SIZE;  // Increment index
 	}
+	L2C_Sync();  // One sync for the whole range, it stalls the slave port until the buffers are drained
 	__DSB();
+	tru_l2c310_unlock(cpsr);
 }
 
 #endif
 
+// ====================
+// Size-adaptive ranges
+// ====================
+// These pick per cache level, from the range size, the cheaper of the range operation above and the
+// whole cache operation (L1 by set/way, L2 by way).  The size thresholds are measured by
+// tru_cache_calibrate(), else defaults are used.
+// The L1 whole cache operation only affects the cache of the calling core.  The L2 cache is shared, so
+// the by-way operation is only used with TRU_CACHE_L2_WAY_OPS = 1U, and it cleans the lines of the other
+// core too.  It runs in the background, and no other L2 maintenance may be issued until it completes,
+// so it holds the L2 maintenance lock with IRQs masked, like every trulib L2 maintenance function of
+// both apps.  The IRQs stay masked for the whole operation.  L2 maintenance outside of trulib, e.g. the
+// CMSIS L2C_ functions, does not take the lock and must not run at the same time on the other core.
+// The adaptive invalidate cleans and invalidates the whole cache above the threshold, so the range
+// must have no dirty lines, i.e. it was cleaned or invalidated before the device wrote to it.
+
+#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT != 0U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT != 0U)
+
+typedef struct{
+	uint32_t l1;  // Range size in bytes from which the whole L1 cache operation is used
+	uint32_t l2;  // Range size in bytes from which the whole L2 cache operation is used
+}tru_cache_thresholds_t;
+
+extern tru_cache_thresholds_t tru_cache_thresholds;
+
+void tru_cache_calibrate(void);
+void tru_cache_print_config(void);  // CACHECFG line of the build settings and the hardware state
+void tru_cache_data_clean_range(void *buf, uint32_t len);
+void tru_cache_data_inv_range(void *buf, uint32_t len);
+void tru_cache_data_cleaninv_range(void *buf, uint32_t len);
+
+// ========
+// DMA sync
+// ========
+// Cache maintenance for a buffer shared with a DMA master (not needed for the non-cacheable .dma_buffer section, or
+// for an .acp_buffer buffer accessed by an FPGA master through the ACP, see c5soc/tru_c5soc_hps_acp_ll.h).
+// Call tru_dma_sync_for_device() before starting the transfer and tru_dma_sync_for_cpu() after it has completed.
+// The L1 and L2 operations are done in one pass over the range in chunks, in the required order (L1 then L2 to
+// clean, L2 then L1 to invalidate), with one barrier per chunk.  Ranges above the thresholds of both cache levels
+// use the size-adaptive functions instead.
+// A partial cache line at an unaligned edge is cleaned and invalidated instead of invalidated, so the neighbouring
+// data is not lost.  The neighbouring data must not be written during the transfer from the device, or the device
+// data in that line will be overwritten.
+
+// Range size of one pass of each cache level, a multiple of the cache line size
+#ifndef TRU_DMA_SYNC_CHUNK_SIZE
+	#define TRU_DMA_SYNC_CHUNK_SIZE 4096U
+#endif
+
+typedef enum{
+	TRU_DMA_TO_DEVICE = 0,  // The device reads the buffer
+	TRU_DMA_FROM_DEVICE,    // The device writes the buffer
+	TRU_DMA_BIDIRECTIONAL   // The device reads and writes the buffer
+}tru_dma_dir_t;
+
+void tru_dma_sync_for_device(void *buf, uint32_t len, tru_dma_dir_t dir);
+void tru_dma_sync_for_cpu(void *buf, uint32_t len, tru_dma_dir_t dir);
+
+#endif
+
 #elif(TRU_TARGET == TRU_TARGET_STM32H7)
 
 #include "stm32h7xx_hal.h"
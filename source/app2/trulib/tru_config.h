@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251208
+	Version: 20261019
 
 	Trulib configuration
 */
@@ -56,6 +56,18 @@
 	#endif
 #endif
 
+#ifndef TRU_CPU_FAMILY
+	#if defined(TRU_CFG_CPU_FAMILY)
+		#define TRU_CPU_FAMILY TRU_CFG_CPU_FAMILY
+	#elif(TRU_TARGET == TRU_TARGET_C5SOC)
+		#define TRU_CPU_FAMILY TRU_CPU_FAMILY_CORTEXA9
+	#elif(TRU_TARGET == TRU_TARGET_STM32H7)
+		#define TRU_CPU_FAMILY TRU_CPU_FAMILY_CORTEXM7
+	#else
+		#error "TRU_CFG_CPU_FAMILY or TRU_CPU_FAMILY define not set!"
+	#endif
+#endif
+
 #ifndef TRU_BOARD_HEADER
 	#if defined(TRU_CFG_BOARD_HEADER)
 		#define TRU_BOARD_HEADER TRU_CFG_BOARD_HEADER
@@ -81,18 +93,6 @@
 	#error "TRU_TARGET define has an unsupported value!"
 #endif
 
-#ifndef TRU_CPU_FAMILY
-	#if defined(TRU_CFG_CPU_FAMILY)
-		#define TRU_CPU_FAMILY TRU_CFG_CPU_FAMILY
-	#elif(TRU_TARGET == TRU_TARGET_C5SOC)
-		#define TRU_CPU_FAMILY TRU_CPU_FAMILY_CORTEXA9
-	#elif(TRU_TARGET == TRU_TARGET_STM32H7)
-		#define TRU_CPU_FAMILY TRU_CPU_FAMILY_CORTEXM7
-	#else
-		#error "TRU_CFG_CPU_FAMILY or TRU_CPU_FAMILY define not set!"
-	#endif
-#endif
-
 // Use CMSIS for startup and CPU stuff
 #if !defined(TRU_CMSIS) && defined(TRU_CFG_CMSIS)
 	#define TRU_CMSIS TRU_CFG_CMSIS
@@ -141,6 +141,86 @@
 	#define TRU_DMA_BUFFER_NONCACHEABLE TRU_CFG_DMA_BUFFER_NONCACHEABLE
 #endif
 
+// Paint the processor mode stacks at startup for stack usage measurement (see arm/tru_stack.h)
+#if !defined(TRU_STACK_PAINT) && defined(TRU_CFG_STACK_PAINT)
+	#define TRU_STACK_PAINT TRU_CFG_STACK_PAINT
+#endif
+
+// Idle "stay hot" busy-poll window in global timer ticks before entering WFI (see arm/tru_idle.h)
+#if !defined(TRU_IDLE_HOT_TICKS) && defined(TRU_CFG_IDLE_HOT_TICKS)
+	#define TRU_IDLE_HOT_TICKS TRU_CFG_IDLE_HOT_TICKS
+#endif
+
+// Maximum number of active software timers (see arm/tru_timer.h)
+#if !defined(TRU_TIMER_MAX) && defined(TRU_CFG_TIMER_MAX)
+	#define TRU_TIMER_MAX TRU_CFG_TIMER_MAX
+#endif
+
+// Capture the interrupted PC in IRQ_Handler for the sampling profiler (see arm/tru_prof.h)
+#if !defined(TRU_PROF) && defined(TRU_CFG_PROF)
+	#define TRU_PROF TRU_CFG_PROF
+#endif
+
+// Per-IRQ handler statistics and entry time stamp in IRQ_Handler (see arm/tru_irq_stats.h)
+#if !defined(TRU_IRQ_STATS) && defined(TRU_CFG_IRQ_STATS)
+	#define TRU_IRQ_STATS TRU_CFG_IRQ_STATS
+#endif
+
+// Benchmark time unit, 1 = PMU cycles, 0 = global timer ticks (see arm/tru_bench.h)
+#if !defined(TRU_BENCH_PMU) && defined(TRU_CFG_BENCH_PMU)
+	#define TRU_BENCH_PMU TRU_CFG_BENCH_PMU
+#endif
+
+// Benchmark L2 data read hit ratio (see arm/tru_bench.h)
+#if !defined(TRU_BENCH_L2_EVENTS) && defined(TRU_CFG_BENCH_L2_EVENTS)
+	#define TRU_BENCH_L2_EVENTS TRU_CFG_BENCH_L2_EVENTS
+#endif
+
+// Boot time profiler, time stamps each startup phase into the shared memory (see arm/tru_boot_prof.h)
+#if !defined(TRU_BOOT_PROF) && defined(TRU_CFG_BOOT_PROF)
+	#define TRU_BOOT_PROF TRU_CFG_BOOT_PROF
+#endif
+
+// App2 runs the load generator for app1 (see arm/tru_amp_load.h)
+#if !defined(TRU_AMP_LOAD) && defined(TRU_CFG_AMP_LOAD)
+	#define TRU_AMP_LOAD TRU_CFG_AMP_LOAD
+#endif
+
+// The size-adaptive cache functions may use the L2 by-way operations (see tru_cache.h)
+#if !defined(TRU_CACHE_L2_WAY_OPS) && defined(TRU_CFG_CACHE_L2_WAY_OPS)
+	#define TRU_CACHE_L2_WAY_OPS TRU_CFG_CACHE_L2_WAY_OPS
+#endif
+
+// L2 ways the core can allocate into (see arm/tru_cache_l2c310.h)
+#if !defined(TRU_L2_WAYS) && defined(TRU_CFG_L2_WAYS)
+	#define TRU_L2_WAYS TRU_CFG_L2_WAYS
+#endif
+
+// L2 prefetch control register value (see arm/tru_cache_l2c310.h)
+#if !defined(TRU_L2_PREFETCH) && defined(TRU_CFG_L2_PREFETCH)
+	#define TRU_L2_PREFETCH TRU_CFG_L2_PREFETCH
+#endif
+
+// L2 early write response
+#if !defined(TRU_L2_EARLY_BRESP) && defined(TRU_CFG_L2_EARLY_BRESP)
+	#define TRU_L2_EARLY_BRESP TRU_CFG_L2_EARLY_BRESP
+#endif
+
+// L2 pinning of the .fast section
+#if !defined(TRU_L2_PIN_FAST) && defined(TRU_CFG_L2_PIN_FAST)
+	#define TRU_L2_PIN_FAST TRU_CFG_L2_PIN_FAST
+#endif
+
+// NEON memcpy PLD distance
+#if !defined(TRU_MEM_PLD_DIST) && defined(TRU_CFG_MEM_PLD_DIST)
+	#define TRU_MEM_PLD_DIST TRU_CFG_MEM_PLD_DIST
+#endif
+
+// NEON memcpy, memmove and memset replace newlib's
+#if !defined(TRU_MEM_OVERRIDE) && defined(TRU_CFG_MEM_OVERRIDE)
+	#define TRU_MEM_OVERRIDE TRU_CFG_MEM_OVERRIDE
+#endif
+
 #if !defined(TRU_USB_LOG_INIT) && defined(TRU_CFG_USB_LOG_INIT)
 	#define TRU_USB_LOG_INIT TRU_CFG_USB_LOG_INIT
 #endif
@@ -179,6 +259,8 @@
 // Settings:
 //   L1_CACHE_ENABLE: 0 = disable L1 cache, 1 = disable, invalidate and enable L1 cache, 2 = do nothing
 //   L2_CACHE_ENABLE: 0 = disable L2 cache, 1 = disable, invalidate and enable L2 cache, 2 = do nothing
+// A setting defined on the compiler command line (e.g. -DTRU_L1_CACHE=0U) takes priority over both the user
+// configuration and the defaults below, see scripts-py/cache_matrix.py
 
 #if defined(TRU_EXIT_TO_UBOOT) && TRU_EXIT_TO_UBOOT == 1U
 	// We do not want cache in DEBUG mode
@@ -186,42 +268,42 @@
 		#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U)
 			#if !defined(TRU_CLEAN_CACHE) && defined(TRU_CFG_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE TRU_CFG_CLEAN_CACHE
-			#else
+			#elif !defined(TRU_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE 0U
 			#endif
 		#endif
 		#if defined(TRU_MMU_PRESENT) && TRU_MMU_PRESENT == 1U
 			#if !defined(TRU_MMU) && defined(TRU_CFG_MMU)
 				#define TRU_MMU TRU_CFG_MMU
-			#else
+			#elif !defined(TRU_MMU)
 				#define TRU_MMU 2U
 			#endif
 		#endif
 		#if defined(TRU_SMP_COHERENCY_PRESENT) && TRU_SMP_COHERENCY_PRESENT == 1U
 			#if !defined(TRU_SMP_COHERENCY) && defined(TRU_CFG_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY TRU_CFG_SMP_COHERENCY
-			#else
+			#elif !defined(TRU_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY 2U
 			#endif
 		#endif
 		#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U
 			#if !defined(TRU_L1_CACHE) && defined(TRU_CFG_L1_CACHE)
 				#define TRU_L1_CACHE TRU_CFG_L1_CACHE
-			#else
+			#elif !defined(TRU_L1_CACHE)
 				#define TRU_L1_CACHE 2U
 			#endif
 		#endif
 		#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U
 			#if !defined(TRU_L2_CACHE) && defined(TRU_CFG_L2_CACHE)
 				#define TRU_L2_CACHE TRU_CFG_L2_CACHE
-			#else
+			#elif !defined(TRU_L2_CACHE)
 				#define TRU_L2_CACHE 2U
 			#endif
 		#endif
 		#if defined(TRU_SCU_PRESENT) && TRU_SCU_PRESENT == 1U
 			#if !defined(TRU_SCU) && defined(TRU_CFG_SCU)
 				#define TRU_SCU TRU_CFG_SCU
-			#else
+			#elif !defined(TRU_SCU)
 				#define TRU_SCU 2U
 			#endif
 		#endif
@@ -229,42 +311,42 @@
 		#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U)
 			#if !defined(TRU_CLEAN_CACHE) && defined(TRU_CFG_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE TRU_CFG_CLEAN_CACHE
-			#else
+			#elif !defined(TRU_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE 0U
 			#endif
 		#endif
 		#if defined(TRU_MMU_PRESENT) && TRU_MMU_PRESENT == 1U
 			#if !defined(TRU_MMU) && defined(TRU_CFG_MMU)
 				#define TRU_MMU TRU_CFG_MMU
-			#else
+			#elif !defined(TRU_MMU)
 				#define TRU_MMU 2U
 			#endif
 		#endif
 		#if defined(TRU_SMP_COHERENCY_PRESENT) && TRU_SMP_COHERENCY_PRESENT == 1U
 			#if !defined(TRU_SMP_COHERENCY) && defined(TRU_CFG_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY TRU_CFG_SMP_COHERENCY
-			#else
+			#elif !defined(TRU_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY 2U
 			#endif
 		#endif
 		#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U
 			#if !defined(TRU_L1_CACHE) && defined(TRU_CFG_L1_CACHE)
 				#define TRU_L1_CACHE TRU_CFG_L1_CACHE
-			#else
+			#elif !defined(TRU_L1_CACHE)
 				#define TRU_L1_CACHE 2U
 			#endif
 		#endif
 		#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U
 			#if !defined(TRU_L2_CACHE) && defined(TRU_CFG_L2_CACHE)
 				#define TRU_L2_CACHE TRU_CFG_L2_CACHE
-			#else
+			#elif !defined(TRU_L2_CACHE)
 				#define TRU_L2_CACHE 2U
 			#endif
 		#endif
 		#if defined(TRU_SCU_PRESENT) && TRU_SCU_PRESENT == 1U
 			#if !defined(TRU_SCU) && defined(TRU_CFG_SCU)
 				#define TRU_SCU TRU_CFG_SCU
-			#else
+			#elif !defined(TRU_SCU)
 				#define TRU_SCU 2U
 			#endif
 		#endif
@@ -275,42 +357,42 @@
 		#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U)
 			#if !defined(TRU_CLEAN_CACHE) && defined(TRU_CFG_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE TRU_CFG_CLEAN_CACHE
-			#else
+			#elif !defined(TRU_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE 0U
 			#endif
 		#endif
 		#if defined(TRU_MMU_PRESENT) && TRU_MMU_PRESENT == 1U
 			#if !defined(TRU_MMU) && defined(TRU_CFG_MMU)
 				#define TRU_MMU TRU_CFG_MMU
-			#else
+			#elif !defined(TRU_MMU)
 				#define TRU_MMU 1U
 			#endif
 		#endif
 		#if defined(TRU_SMP_COHERENCY_PRESENT) && TRU_SMP_COHERENCY_PRESENT == 1U
 			#if !defined(TRU_SMP_COHERENCY) && defined(TRU_CFG_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY TRU_CFG_SMP_COHERENCY
-			#else
+			#elif !defined(TRU_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY 0U
 			#endif
 		#endif
 		#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U
 			#if !defined(TRU_L1_CACHE) && defined(TRU_CFG_L1_CACHE)
 				#define TRU_L1_CACHE TRU_CFG_L1_CACHE
-			#else
+			#elif !defined(TRU_L1_CACHE)
 				#define TRU_L1_CACHE 0U
 			#endif
 		#endif
 		#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U
 			#if !defined(TRU_L2_CACHE) && defined(TRU_CFG_L2_CACHE)
 				#define TRU_L2_CACHE TRU_CFG_L2_CACHE
-			#else
+			#elif !defined(TRU_L2_CACHE)
 				#define TRU_L2_CACHE 0U
 			#endif
 		#endif
 		#if defined(TRU_SCU_PRESENT) && TRU_SCU_PRESENT == 1U
 			#if !defined(TRU_SCU) && defined(TRU_CFG_SCU)
 				#define TRU_SCU TRU_CFG_SCU
-			#else
+			#elif !defined(TRU_SCU)
 				#define TRU_SCU 0U
 			#endif
 		#endif
@@ -318,42 +400,42 @@
 		#if (defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U) || (defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U)
 			#if !defined(TRU_CLEAN_CACHE) && defined(TRU_CFG_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE TRU_CFG_CLEAN_CACHE
-			#else
+			#elif !defined(TRU_CLEAN_CACHE)
 				#define TRU_CLEAN_CACHE 0U
 			#endif
 		#endif
 		#if defined(TRU_MMU_PRESENT) && TRU_MMU_PRESENT == 1U
 			#if !defined(TRU_MMU) && defined(TRU_CFG_MMU)
 				#define TRU_MMU TRU_CFG_MMU
-			#else
+			#elif !defined(TRU_MMU)
 				#define TRU_MMU 1U
 			#endif
 		#endif
 		#if defined(TRU_SMP_COHERENCY_PRESENT) && TRU_SMP_COHERENCY_PRESENT == 1U
 			#if !defined(TRU_SMP_COHERENCY) && defined(TRU_CFG_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY TRU_CFG_SMP_COHERENCY
-			#else
+			#elif !defined(TRU_SMP_COHERENCY)
 				#define TRU_SMP_COHERENCY 1U
 			#endif
 		#endif
 		#if defined(TRU_L1_CACHE_PRESENT) && TRU_L1_CACHE_PRESENT == 1U
 			#if !defined(TRU_L1_CACHE) && defined(TRU_CFG_L1_CACHE)
 				#define TRU_L1_CACHE TRU_CFG_L1_CACHE
-			#else
+			#elif !defined(TRU_L1_CACHE)
 				#define TRU_L1_CACHE 1U
 			#endif
 		#endif
 		#if defined(TRU_L2_CACHE_PRESENT) && TRU_L2_CACHE_PRESENT == 1U
 			#if !defined(TRU_L2_CACHE) && defined(TRU_CFG_L2_CACHE)
 				#define TRU_L2_CACHE TRU_CFG_L2_CACHE
-			#else
+			#elif !defined(TRU_L2_CACHE)
 				#define TRU_L2_CACHE 1U
 			#endif
 		#endif
 		#if defined(TRU_SCU_PRESENT) && TRU_SCU_PRESENT == 1U
 			#if !defined(TRU_SCU) && defined(TRU_CFG_SCU)
 				#define TRU_SCU TRU_CFG_SCU
-			#else
+			#elif !defined(TRU_SCU)
 				#define TRU_SCU 1U
 			#endif
 		#endif
@@ -21,7 +21,7 @@
 	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 	SOFTWARE.
 
-	Version: 20251206
+	Version: 20261019
 
 	Minimal implementation of required newlib function stubs.
 */
@@ -31,6 +31,7 @@
 #if(TRU_TARGET == TRU_TARGET_C5SOC)
 
 #include "tru_logger.h"
+#include "arm/tru_idle.h"
 
 #include <errno.h>
 #include <sys/stat.h>
@@ -95,8 +96,8 @@
 	}
 
 	void __attribute__((weak, noreturn)) _exit(int status){
-		LOG("Starting infinity loop\n");
-		while(1);
+		LOG("Starting infinity idle loop\n");
+		tru_idle_forever();  // Sleep in WFI instead of spinning
 	}
 #endif
 
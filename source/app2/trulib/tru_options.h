@@ -6,11 +6,13 @@
 
 #define TRU_CPU_FAMILY_CORTEXA9 0
 #define TRU_CPU_FAMILY_CORTEXM7 1
+#define TRU_CPU_FAMILY_HOST     2  // Host build (e.g. x86 Linux) with simulated MMIO, see host/tru_host_mmio.h
 
 #define TRU_BOARD_CUSTOM          0
 #define TRU_BOARD_C5SOC_CUSTOM    1
 #define TRU_BOARD_DE10NANO        2
 #define TRU_BOARD_STM32H7_CUSTOM  3
 #define TRU_BOARD_NUCLEO144_753ZI 4
+#define TRU_BOARD_QEMU_VEXPRESSA9 5
 
 #endif
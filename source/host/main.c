@@ -0,0 +1,220 @@
+/*
+	MIT License
+
+	Copyright (c) 2026 Truong Hy
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+
+	Version: 20261019
+
+	Host build of trulib with simulated HPS peripherals.
+
+	Runs the UART and clock manager drivers against simulated registers, checks
+	the results and times the driver code.  Build and run with:
+		make -f Makefile-host.mk run
+*/
+
+#include "tru_config.h"
+#include "tru_host_mmio.h"
+#include "tru_c5soc_hps_uart_ll.h"
+#include "tru_c5soc_hps_uart_pt.h"
+#include "tru_c5soc_hps_clkmgr_ll.h"
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#define SIM_UART_FIFO_DEPTH 16U  // Simulated transmit FIFO depth
+#define SIM_UART_TX_READS   2U   // A byte is transmitted every N line status register reads
+#define BENCH_LEN           4096U
+#define BENCH_RUNS          16U
+
+// ===================
+// Simulated HPS UART0
+// ===================
+
+typedef struct{
+	uint32_t count;     // Bytes in the transmit FIFO
+	uint32_t reads;     // Line status register reads since the last transmitted byte
+	uint32_t tx_total;  // Bytes transmitted
+	bool echo;          // Write the transmitted bytes to stdout
+}sim_uart_t;
+
+static sim_uart_t sim_uart;
+
+static uint32_t sim_uart_lsr_rd(void *ctx, uintptr_t addr, uint32_t val){
+	sim_uart_t *uart = ctx;
+
+	// Simulate the transmission
+	if(uart->count && ++uart->reads >= SIM_UART_TX_READS){
+		uart->reads = 0U;
+		uart->count--;
+		uart->tx_total++;
+	}
+
+	// In FIFO & threshold mode THRE = 1 means the FIFO is full, else THRE = 1 means the holding register is empty
+	bool fifo_th_en = *tru_host_mmio_ptr(TRU_HPS_UART0_SFE_ADDR) && *tru_host_mmio_ptr(TRU_HPS_UART0_STET_ADDR);
+	uint32_t depth = fifo_th_en ? SIM_UART_FIFO_DEPTH : 1U;
+	val = 0U;
+	if(uart->count == 0U) val |= TRU_HPS_UART_LSR_TEMT_SET_MSK;
+	if(fifo_th_en){
+		if(uart->count >= depth) val |= TRU_HPS_UART_LSR_THRE_SET_MSK;
+	}else{
+		if(uart->count < depth) val |= TRU_HPS_UART_LSR_THRE_SET_MSK;
+	}
+	return val;
+}
+
+static void sim_uart_thr_wr(void *ctx, uintptr_t addr, uint32_t val){
+	sim_uart_t *uart = ctx;
+	uart->count++;
+	if(uart->echo && (char)val != '\r') putchar((char)val);
+}
+
+static int32_t sim_uart_init(bool fifo_th_en){
+	if(tru_host_mmio_map(TRU_HPS_UART0_BASE, 0x100U)) return -1;
+	if(tru_host_mmio_hook(TRU_HPS_UART0_LSR_ADDR, sim_uart_lsr_rd, NULL, &sim_uart)) return -1;
+	if(tru_host_mmio_hook(TRU_HPS_UART0_RBR_THR_DLL_ADDR, NULL, sim_uart_thr_wr, &sim_uart)) return -1;
+	*tru_host_mmio_ptr(TRU_HPS_UART0_SFE_ADDR) = fifo_th_en ? 1U : 0U;
+	*tru_host_mmio_ptr(TRU_HPS_UART0_STET_ADDR) = fifo_th_en ? 3U : 0U;
+	memset(&sim_uart, 0, sizeof(sim_uart));
+	return 0;
+}
+
+// ==============================
+// Simulated HPS clock manager
+// ==============================
+
+static int32_t sim_clkmgr_init(void){
+	if(tru_host_mmio_map(TRU_HPS_CLKMGR_BASE, 0x100U)) return -1;
+
+	// 25MHz / 2 * 64 = 800MHz VCO, C0 = 1, K = 1
+	*tru_host_mmio_ptr(TRU_HPS_CLKMGR_MAINPLL_VCO) = (1U << 16) | (63U << 3);
+	*tru_host_mmio_ptr(TRU_HPS_CLKMGR_MAINPLL_C0) = 0U;
+	*tru_host_mmio_ptr(TRU_HPS_CLKMGR_ALTERA_K_C0) = 0U;
+	return 0;
+}
+
+// =====
+// Tests
+// =====
+
+static uint64_t now_ns(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Overlapping blocks must be refused, including one that encloses an existing block
+static int32_t test_mmio_map(void){
+	int32_t res = 0;
+
+	if(tru_host_mmio_map(0x1000U, 0x100U)) return -1;
+	if(tru_host_mmio_map(0x1080U, 0x10U) == 0) res = -1;   // Inside
+	if(tru_host_mmio_map(0x0f80U, 0x100U) == 0) res = -1;  // Overlaps the start
+	if(tru_host_mmio_map(0x0f00U, 0x400U) == 0) res = -1;  // Encloses
+	if(tru_host_mmio_map(0x1100U, 0x100U)) res = -1;       // Adjacent
+	tru_host_mmio_unmap_all();
+	return res;
+}
+
+static int32_t test_clkmgr(void){
+	tru_hps_clk_t clk = get_mpu_base_clk(TRU_HPS_INPUT_CLK_HZ);
+	printf("clkmgr: mpu_base n=%" PRIu32 " m=%" PRIu32 " c=%" PRIu32 " k=%" PRIu32 " fout=%.0fHz\n", clk.n, clk.m, clk.c, clk.k, clk.fout);
+	return (clk.fout == 800000000.0f) ? 0 : -1;
+}
+
+static int32_t test_uart(bool fifo_th_en){
+	const char msg[] = "Hello from the simulated UART\n";
+	uint32_t len = sizeof(msg) - 1U;
+
+	if(sim_uart_init(fifo_th_en)) return -1;
+	sim_uart.echo = true;
+
+	// Blocking writer
+	printf("uart_ll (fifo_th_en=%u): ", fifo_th_en);
+	tru_hps_uart_ll_write_str((void *)TRU_HPS_UART0_BASE, msg, len);
+	tru_hps_uart_ll_wait_empty((void *)TRU_HPS_UART0_BASE);
+
+	// Non-blocking writer
+	printf("uart_pt (fifo_th_en=%u): ", fifo_th_en);
+	tru_hps_uart_pt_writer_t w;
+	uint32_t waits = 0U;
+	tru_hps_uart_pt_write_init(&w, (void *)TRU_HPS_UART0_BASE, msg, len);
+	while(TRU_PT_SCHEDULE(tru_hps_uart_pt_write(&w))) waits++;
+	tru_hps_uart_ll_wait_empty((void *)TRU_HPS_UART0_BASE);
+	printf("uart_pt: %" PRIu32 " waits\n", waits);
+
+	sim_uart.echo = false;
+	tru_host_mmio_unmap_all();
+
+	// Each '\n' has an extra '\r'
+	#if defined(TRU_LOG_RN) && TRU_LOG_RN == 1U
+		uint32_t expected = 2U * (len + 1U);
+	#else
+		uint32_t expected = 2U * len;
+	#endif
+	return (sim_uart.tx_total == expected) ? 0 : -1;
+}
+
+static int32_t bench_uart(bool fifo_th_en){
+	static char buf[BENCH_LEN];
+	uint64_t min = UINT64_MAX;
+
+	memset(buf, 'x', sizeof(buf));
+	if(sim_uart_init(fifo_th_en)) return -1;
+	for(uint32_t i = 0U; i < BENCH_RUNS; i++){
+		uint64_t t = now_ns();
+		tru_hps_uart_ll_write_str((void *)TRU_HPS_UART0_BASE, buf, sizeof(buf));
+		t = now_ns() - t;
+		if(t < min) min = t;
+	}
+	tru_host_mmio_unmap_all();
+
+	printf("BENCH uart_ll_write_str_%s unit=ns runs=%u min=%" PRIu64 " ns_per_byte=%.2f\n", fifo_th_en ? "fifo" : "nofifo", BENCH_RUNS, min, (double)min / BENCH_LEN);
+	return 0;
+}
+
+int main(void){
+	int32_t fails = 0;
+
+	if(test_mmio_map()){
+		printf("FAIL: mmio_map\n");
+		fails++;
+	}
+
+	if(sim_clkmgr_init() || test_clkmgr()){
+		printf("FAIL: clkmgr\n");
+		fails++;
+	}
+	tru_host_mmio_unmap_all();
+
+	for(uint32_t i = 0U; i < 2U; i++){
+		if(test_uart(i)){
+			printf("FAIL: uart (fifo_th_en=%" PRIu32 ")\n", i);
+			fails++;
+		}
+	}
+
+	bench_uart(false);
+	bench_uart(true);
+
+	printf("%s\n", fails ? "FAILED" : "PASSED");
+	return fails ? 1 : 0;
+}